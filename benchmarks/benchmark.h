@@ -0,0 +1,82 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <CLBL/clbl.h>
+
+/*
+Minimal timing helpers shared by the CLBL benchmarks. Each benchmark
+is a standalone program - build with optimizations, e.g.
+
+    clang++ -std=c++14 -O2 -I../include function_ref_benchmarks.cpp
+
+Multi-threaded benchmarks also need -pthread.
+*/
+
+#if defined(_MSC_VER)
+#define CLBL_BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define CLBL_BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+namespace clbl { namespace benchmarks {
+
+    static volatile char benchmark_sink;
+
+    //forces the optimizer to materialize a value without adding a call
+    template<typename T>
+    inline void do_not_optimize(const T& value) {
+        benchmark_sink = *reinterpret_cast<const volatile char*>(&value);
+    }
+
+    //prints and returns the average time per iteration of f(i), in nanoseconds
+    template<typename F>
+    inline double measure(const char* name, std::size_t iterations, F&& f) {
+        using clock = std::chrono::steady_clock;
+        auto start = clock::now();
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            f(i);
+        }
+
+        auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start);
+        auto result = elapsed.count() / static_cast<double>(iterations);
+        std::cout << name << ": " << result << " ns" << std::endl;
+        return result;
+    }
+
+    /*
+    runs f(thread_index, i) for iterations iterations on each of thread_count threads,
+    then prints and returns the wall time per iteration, in nanoseconds
+    */
+    template<typename F>
+    inline double measure_threads(const char* name, std::size_t thread_count, std::size_t iterations, F&& f) {
+        using clock = std::chrono::steady_clock;
+        std::vector<std::thread> threads;
+        auto start = clock::now();
+
+        for (std::size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&f, t, iterations] {
+                for (std::size_t i = 0; i < iterations; ++i) {
+                    f(t, i);
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start);
+        auto result = elapsed.count() / static_cast<double>(iterations);
+        std::cout << name << " (" << thread_count << " threads): " << result << " ns" << std::endl;
+        return result;
+    }
+}}
+
+#endif
\ No newline at end of file
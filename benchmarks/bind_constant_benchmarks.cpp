@@ -0,0 +1,53 @@
+#include "benchmark.h"
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares a kernel with its configuration bound at run time (clbl::bind_front)
+against the same configuration bound at compile time (clbl::bind_constant).
+With constants, the model branch disappears and the step loop is unrolled
+inside the inlined kernel.
+*/
+
+namespace {
+
+    inline double price_kernel(int model, int steps, double spot) {
+        double value = spot;
+        for (int i = 0; i < steps; ++i) {
+            if (model == 0) {
+                value = value * 1.0001 + 0.5;
+            }
+            else {
+                value = value * 0.9999 - 0.25;
+            }
+        }
+        return value;
+    }
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE double call_once(const Function& f, double spot) {
+        return f(spot);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 10000000;
+
+    auto runtime = bind_front(CLBL_FNWRAP(&price_kernel), 0, 8);
+    auto constant = bind_constant<int, 0, 8>(CLBL_FNWRAP(&price_kernel));
+
+    std::cout << "bind_front: " << sizeof(runtime) << " bytes" << std::endl;
+    std::cout << "bind_constant: " << sizeof(constant) << " bytes" << std::endl;
+
+    measure("bind_front (run-time configuration)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(runtime, static_cast<double>(i)));
+    });
+
+    measure("bind_constant (compile-time configuration)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(constant, static_cast<double>(i)));
+    });
+
+    return 0;
+}
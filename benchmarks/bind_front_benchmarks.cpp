@@ -0,0 +1,90 @@
+#include "benchmark.h"
+
+#include <functional>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares clbl::bind_front with std::bind and a capturing lambda - the size of
+the bound object, whether it fits the std::function small buffer, and the call
+latency, both directly and through std::function.
+*/
+
+namespace {
+
+    struct options {};
+
+    struct handler {
+        long state[4] = {};
+
+        long on_request(options, long id, long size) {
+            state[id & 3] += size;
+            return state[id & 3];
+        }
+    };
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE long call_once(Function& f, long size) {
+        return f(size);
+    }
+}
+
+int main() {
+
+    using namespace std::placeholders;
+
+    constexpr std::size_t iterations = 10000000;
+
+    handler h{};
+    long id = 3;
+
+    auto bound = bind_front(CLBL_PMFWRAP(&handler::on_request, &h), options{}, id);
+    auto std_bound = std::bind(&handler::on_request, &h, options{}, id, _1);
+    auto lambda = [&h, id](long size) { return h.on_request(options{}, id, size); };
+
+    std::cout << "clbl::bind_front: " << sizeof(bound) << " bytes, "
+        << "fits: " << fits_small_buffer<std::function, decltype(bound)&> << std::endl;
+    std::cout << "std::bind: " << sizeof(std_bound) << " bytes" << std::endl;
+    std::cout << "lambda: " << sizeof(lambda) << " bytes" << std::endl;
+
+    measure("clbl::bind_front call", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(bound, static_cast<long>(i)));
+    });
+
+    measure("std::bind call", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(std_bound, static_cast<long>(i)));
+    });
+
+    measure("lambda call", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(lambda, static_cast<long>(i)));
+    });
+
+    auto converted = convert_to<std::function>(bound);
+    std::function<long(long)> std_converted = std_bound;
+    std::function<long(long)> lambda_converted = lambda;
+
+    measure("std::function call (clbl::bind_front)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(converted, static_cast<long>(i)));
+    });
+
+    measure("std::function call (std::bind)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(std_converted, static_cast<long>(i)));
+    });
+
+    measure("std::function call (lambda)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(lambda_converted, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (clbl::bind_front)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(bound);
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (std::bind)", iterations, [&](std::size_t i) {
+        std::function<long(long)> f = std_bound;
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "benchmark.h"
+
+#include <functional>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares a three-stage pipeline erased as one std::function (clbl::compose,
+then clbl::convert_to) against the same pipeline built from a std::function
+per stage, each one calling the next - one indirect call per call instead of
+three, and one small-buffer object instead of three.
+*/
+
+namespace {
+
+    CLBL_BENCHMARK_NOINLINE long scale(long i) { return i * 3; }
+    CLBL_BENCHMARK_NOINLINE long offset(long i) { return i + 7; }
+    CLBL_BENCHMARK_NOINLINE long clamp(long i) { return i & 0xffff; }
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE long call_once(const Function& f, long i) {
+        return f(i);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 10000000;
+
+    auto pipeline = compose(CLBL_FNWRAP(&scale), CLBL_FNWRAP(&offset), CLBL_FNWRAP(&clamp));
+
+    std::cout << "clbl::compose: " << sizeof(pipeline) << " bytes, "
+        << "fits: " << fits_small_buffer<std::function, decltype(pipeline)&> << std::endl;
+
+    auto fused = convert_to<std::function>(pipeline);
+
+    std::function<long(long)> first = &scale;
+    std::function<long(long)> second = [&first](long i) { return offset(first(i)); };
+    std::function<long(long)> nested = [&second](long i) { return clamp(second(i)); };
+
+    measure("clbl::compose call", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(pipeline, static_cast<long>(i)));
+    });
+
+    measure("std::function call (clbl::compose)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(fused, static_cast<long>(i)));
+    });
+
+    measure("std::function call (nested std::function)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(nested, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (clbl::compose)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(compose(CLBL_FNWRAP(&scale), CLBL_FNWRAP(&offset), CLBL_FNWRAP(&clamp)));
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (nested std::function)", iterations, [&](std::size_t i) {
+        std::function<long(long)> a = &scale;
+        std::function<long(long)> b = [&a](long x) { return offset(a(x)); };
+        std::function<long(long)> c = [&b](long x) { return clamp(b(x)); };
+        do_not_optimize(call_once(c, static_cast<long>(i)));
+    });
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include "benchmark.h"
+
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Measures the size and call latency of pmf_ptr_wrapper with a raw object
+pointer (compressed PMF: a function pointer and a pre-adjusted "this")
+against the same wrapper around a pointer-like type, which stores the PMF
+as it is. The base class PMF needs a "this" adjustment. A polymorphic
+class keeps the stored PMF either way, since its PMFs may be virtual.
+*/
+
+namespace {
+
+    struct logger {
+        long lines = 0;
+    };
+
+    struct counter {
+        long count = 0;
+
+        long add(long i) {
+            count += i;
+            return count;
+        }
+    };
+
+    struct service : logger, counter {};
+
+    struct virtual_service : service {
+        virtual ~virtual_service() {}
+    };
+
+    template<typename T>
+    struct plain_ptr {
+        T* ptr;
+        T& operator*() const { return *ptr; }
+    };
+
+    template<typename Callback>
+    CLBL_BENCHMARK_NOINLINE long call_all(std::vector<Callback>& callbacks, long i) {
+        long result = 0;
+        for (auto& callback : callbacks) {
+            result += callback(i);
+        }
+        return result;
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 100000;
+    constexpr std::size_t callback_count = 64;
+
+    std::vector<service> services(callback_count);
+
+    auto add = static_cast<long(service::*)(long)>(&counter::add);
+
+    std::vector<decltype(fwrap(&services[0], add))> compressed;
+    std::vector<decltype(fwrap(plain_ptr<service>{}, add))> uncompressed;
+
+    for (auto& s : services) {
+        compressed.push_back(fwrap(&s, add));
+        uncompressed.push_back(fwrap(plain_ptr<service>{ &s }, add));
+    }
+
+    virtual_service v{};
+    auto virtual_add = static_cast<long(virtual_service::*)(long)>(&counter::add);
+
+    std::cout << "sizeof(fwrap(&object, pmf)): " << sizeof(compressed[0])
+        << ", sizeof(fwrap(plain_ptr, pmf)): " << sizeof(uncompressed[0])
+        << ", sizeof(fwrap(&polymorphic_object, pmf)): " << sizeof(fwrap(&v, virtual_add)) << std::endl;
+
+    measure("64 calls, stored PMF", iterations, [&](std::size_t i) {
+        do_not_optimize(call_all(uncompressed, static_cast<long>(i)));
+    });
+
+    measure("64 calls, compressed PMF", iterations, [&](std::size_t i) {
+        do_not_optimize(call_all(compressed, static_cast<long>(i)));
+    });
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "benchmark.h"
+
+#include <functional>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares a callable with three middleware layers (metrics, validation and a
+disabled logging layer) built with clbl::decorate against the same layers built
+by nesting std::functions - both called directly, and after erasing the whole
+stack into one std::function.
+*/
+
+namespace {
+
+    constexpr bool logging_enabled = false;
+
+    CLBL_BENCHMARK_NOINLINE long transfer(long from, long amount) { return from - amount; }
+
+    struct count_calls {
+        long* calls;
+
+        template<typename Next, typename... Args>
+        long operator()(Next&& next, Args&&... a) const {
+            ++*calls;
+            return std::forward<Next>(next)(std::forward<Args>(a)...);
+        }
+    };
+
+    struct reject_negative {
+        template<typename Next>
+        long operator()(Next&& next, long from, long amount) const {
+            return amount < 0 ? from : std::forward<Next>(next)(from, amount);
+        }
+    };
+
+    struct log_call {
+        template<typename Next, typename... Args>
+        long operator()(Next&& next, Args&&... a) const {
+            std::cout << "transfer" << std::endl;
+            return std::forward<Next>(next)(std::forward<Args>(a)...);
+        }
+    };
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE long call_once(const Function& f, long i) {
+        return f(i, i & 7);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 10000000;
+
+    long calls = 0;
+
+    auto decorated = decorate(CLBL_FNWRAP(&transfer),
+        count_calls{ &calls }, reject_negative{}, advice_if<logging_enabled>(log_call{}));
+
+    std::cout << "clbl::decorate: " << sizeof(decorated) << " bytes, "
+        << "fits: " << fits_small_buffer<std::function, decltype(decorated)&> << std::endl;
+
+    std::function<long(long, long)> inner = &transfer;
+    std::function<long(long, long)> logged = logging_enabled
+        ? std::function<long(long, long)>([&inner](long from, long amount) { return log_call{}(inner, from, amount); })
+        : inner;
+    std::function<long(long, long)> validated = [&logged](long from, long amount) {
+        return reject_negative{}(logged, from, amount);
+    };
+    std::function<long(long, long)> nested = [&validated, &calls](long from, long amount) {
+        return count_calls{ &calls }(validated, from, amount);
+    };
+
+    measure("clbl::decorate call", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(decorated, static_cast<long>(i)));
+    });
+
+    auto erased = convert_to<std::function>(decorated);
+
+    measure("std::function call (clbl::decorate)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(erased, static_cast<long>(i)));
+    });
+
+    measure("std::function call (nested std::function)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(nested, static_cast<long>(i)));
+    });
+
+    do_not_optimize(calls);
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "benchmark.h"
+
+#include <memory>
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares calling polymorphic event handlers through fwrap(ptr, &base::on_event),
+which dispatches through the vtable on every call, against
+fwrap(devirtualize, ptr, &base::on_event), which resolves the final overrider
+once when the wrapper is created.
+*/
+
+namespace {
+
+    struct handler {
+        long count = 0;
+        virtual ~handler() {}
+        virtual long on_event(long e) = 0;
+    };
+
+    struct adder : handler {
+        long on_event(long e) override { return count += e; }
+    };
+
+    struct subtracter : handler {
+        long on_event(long e) override { return count -= e; }
+    };
+
+    struct multiplier : handler {
+        long on_event(long e) override { return count = count * 3 + e; }
+    };
+
+    struct xorer : handler {
+        long on_event(long e) override { return count ^= e; }
+    };
+
+    template<typename Callback>
+    CLBL_BENCHMARK_NOINLINE long dispatch(std::vector<Callback>& callbacks, long e) {
+        long result = 0;
+        for (auto& callback : callbacks) {
+            result += callback(e);
+        }
+        return result;
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 100000;
+    constexpr std::size_t handler_count = 64;
+
+    std::vector<std::unique_ptr<handler> > handlers;
+    for (std::size_t i = 0; i < handler_count; ++i) {
+        //a pseudo-random mix of dynamic types, so the vtable loads aren't all the same
+        switch ((i * 7 + i / 3) % 4) {
+        case 0: handlers.emplace_back(new adder{}); break;
+        case 1: handlers.emplace_back(new subtracter{}); break;
+        case 2: handlers.emplace_back(new multiplier{}); break;
+        default: handlers.emplace_back(new xorer{}); break;
+        }
+    }
+
+    std::vector<decltype(fwrap(handlers[0].get(), &handler::on_event))> late_bound;
+    std::vector<decltype(fwrap(devirtualize, handlers[0].get(), &handler::on_event))> devirtualized;
+
+    for (auto& h : handlers) {
+        late_bound.push_back(fwrap(h.get(), &handler::on_event));
+        devirtualized.push_back(fwrap(devirtualize, h.get(), &handler::on_event));
+    }
+
+    measure("64 handlers, vtable dispatch", iterations, [&](std::size_t i) {
+        do_not_optimize(dispatch(late_bound, static_cast<long>(i)));
+    });
+
+    measure("64 handlers, devirtualized", iterations, [&](std::size_t i) {
+        do_not_optimize(dispatch(devirtualized, static_cast<long>(i)));
+    });
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Schedules small tasks on a clbl::executor: CLBL wrappers with 24 bytes of
+bound state (stored inline in a task slot) against the same wrappers
+converted to std::function first (which allocates for that much state),
+the round trip of a single task, and a fixed amount of work spread over
+an increasing number of workers. Times are per task.
+*/
+
+namespace {
+
+    std::atomic<long> total{ 0 };
+
+    inline void accumulate(long a, long b, long c) {
+        total.fetch_add(a + b + c, std::memory_order_relaxed);
+    }
+
+    inline void spin(long n) {
+        long x = 0;
+        for (long i = 0; i != n; ++i)
+            do_not_optimize(x += i);
+        total.fetch_add(x, std::memory_order_relaxed);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t batch = 1 << 16;
+    constexpr std::size_t iterations = 20;
+
+    {
+        executor ex{};
+
+        auto wrapper_time = measure("submit clbl wrapper (batch)", iterations, [&](std::size_t i) {
+            for (std::size_t j = 0; j != batch; ++j)
+                ex.submit(bind_front(&accumulate, long(i), long(j), 1L));
+            ex.wait_idle();
+        });
+
+        auto function_time = measure("submit std::function (batch)", iterations, [&](std::size_t i) {
+            for (std::size_t j = 0; j != batch; ++j)
+                ex.submit(std::function<void()>{ convert_to<std::function>(bind_front(&accumulate, long(i), long(j), 1L)) });
+            ex.wait_idle();
+        });
+
+        std::cout << "  per task: " << wrapper_time / batch << " ns vs "
+            << function_time / batch << " ns" << std::endl;
+
+        measure("submit + wait_idle (one task)", batch, [&](std::size_t i) {
+            ex.submit(bind_front(&accumulate, long(i), 0L, 0L));
+            ex.wait_idle();
+        });
+    }
+
+    //fixed total work, so the time should fall as workers are added - powers of two, then every core
+    auto max_threads = std::max<std::size_t>(4, std::thread::hardware_concurrency());
+    std::vector<std::size_t> worker_counts{};
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2)
+        worker_counts.push_back(threads);
+    worker_counts.push_back(max_threads);
+
+    for (auto threads : worker_counts) {
+        executor ex{ threads };
+        auto name = "1000-iteration tasks, " + std::to_string(threads) + " worker(s) (batch)";
+        auto time = measure(name.c_str(), iterations, [&](std::size_t) {
+            for (std::size_t j = 0; j != batch / 16; ++j)
+                ex.submit(&spin, 1000L);
+            ex.wait_idle();
+        });
+        std::cout << "  per task: " << time / (batch / 16) << " ns" << std::endl;
+    }
+
+    do_not_optimize(total);
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "benchmark.h"
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares a free function wrapped with clbl::fwrap (the function pointer is
+stored, so calls across a non-inlined boundary are indirect) against
+CLBL_FNWRAP (the function is a template argument, so calls are direct).
+*/
+
+namespace {
+
+    long scale(long value, long factor) {
+        return value * factor + 1;
+    }
+
+    template<typename Callback>
+    CLBL_BENCHMARK_NOINLINE long accumulate(Callback callback, long count) {
+        long result = 0;
+        for (long i = 0; i < count; ++i) {
+            result += callback(i, 3);
+        }
+        return result;
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 100000;
+    volatile long calls_per_iteration = 100;
+
+    auto stored = fwrap(&scale);
+    auto slim = CLBL_FNWRAP(&scale);
+
+    std::cout << "sizeof(fwrap(&scale)): " << sizeof(stored)
+        << ", sizeof(CLBL_FNWRAP(&scale)): " << sizeof(slim) << std::endl;
+
+    measure("fwrap(&scale), 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(accumulate(stored, calls_per_iteration));
+    });
+
+    measure("CLBL_FNWRAP(&scale), 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(accumulate(slim, calls_per_iteration));
+    });
+
+    return 0;
+}
\ No newline at end of file
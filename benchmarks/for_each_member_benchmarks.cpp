@@ -0,0 +1,66 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Calls a member function on every object of a pointer range whose objects are
+scattered across the heap, so most of them are cold: a loop that wraps each
+object with clbl::fwrap, clbl::for_each_member (with prefetching), the
+CLBL_FOR_EACH_MEMBER variant, and the parallel mode. Times are per pass.
+*/
+
+namespace {
+
+    struct entity {
+        double position = 0;
+        double velocity = 1;
+        char padding[112] = {};
+
+        void update(double dt) { position += velocity * dt; }
+    };
+}
+
+int main() {
+
+    constexpr std::size_t count = 1 << 20;
+    constexpr std::size_t iterations = 20;
+
+    //allocate every object separately, and visit them in a random order
+    std::vector<std::unique_ptr<entity> > storage;
+    for (std::size_t i = 0; i != count; ++i)
+        storage.emplace_back(new entity{});
+
+    std::vector<entity*> entities;
+    for (auto& e : storage)
+        entities.push_back(e.get());
+    std::shuffle(entities.begin(), entities.end(), std::mt19937{ 42 });
+
+    measure("fwrap per object", iterations, [&](std::size_t) {
+        for (auto* e : entities)
+            fwrap(e, &entity::update)(0.5);
+        do_not_optimize(entities[0]->position);
+    });
+
+    measure("clbl::for_each_member", iterations, [&](std::size_t) {
+        for_each_member(&entity::update, entities, 0.5);
+        do_not_optimize(entities[0]->position);
+    });
+
+    measure("CLBL_FOR_EACH_MEMBER", iterations, [&](std::size_t) {
+        CLBL_FOR_EACH_MEMBER(&entity::update, entities, 0.5);
+        do_not_optimize(entities[0]->position);
+    });
+
+    measure("clbl::for_each_member (parallel)", iterations, [&](std::size_t) {
+        for_each_member(parallel, &entity::update, entities, 0.5);
+        do_not_optimize(entities[0]->position);
+    });
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include "benchmark.h"
+
+#include <functional>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares passing a CLBL wrapper down the stack as a clbl::function_ref
+against converting it to std::function first.
+*/
+
+namespace {
+
+    struct handler {
+        long state[4] = {};
+
+        long on_request(long id, long size) {
+            state[id & 3] += size;
+            return state[id & 3];
+        }
+    };
+
+    template<typename Callback>
+    CLBL_BENCHMARK_NOINLINE long dispatch(Callback callback, long id) {
+        return callback(id, id * 3);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 10000000;
+
+    handler h{};
+    auto wrapper = fwrap(&h, &handler::on_request);
+
+    measure("std::function construct + call", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(wrapper);
+        do_not_optimize(dispatch<const decltype(f)&>(f, static_cast<long>(i)));
+    });
+
+    measure("function_ref construct + call", iterations, [&](std::size_t i) {
+        auto f = make_function_ref(wrapper);
+        do_not_optimize(dispatch(f, static_cast<long>(i)));
+    });
+
+    auto std_func = convert_to<std::function>(wrapper);
+    auto view = make_function_ref(wrapper);
+
+    measure("std::function call", iterations, [&](std::size_t i) {
+        do_not_optimize(dispatch<const decltype(std_func)&>(std_func, static_cast<long>(i)));
+    });
+
+    measure("function_ref call", iterations, [&](std::size_t i) {
+        do_not_optimize(dispatch(view, static_cast<long>(i)));
+    });
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "benchmark.h"
+
+#include <functional>
+
+#include "../tests/int_char_definitions.h"
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares calls through type-erased numeric callbacks with the forwarding glue
+(int and char passed by value) against the same callbacks with every argument
+wrapped in clbl::forward, which passes the address of each argument instead.
+*/
+
+namespace {
+
+    struct int_char_counter {
+        long total = 0;
+
+        long operator()(int i, char c) {
+            return total += i + c;
+        }
+    };
+
+    using vessel_glue = long(forward<int>, forward<char>);
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE long call_many(const Function& f, long count) {
+        long result = 0;
+        for (long i = 0; i < count; ++i) {
+            result += f(static_cast<int>(i), 'c');
+        }
+        return result;
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 100000;
+    volatile long calls_per_iteration = 100;
+
+    int_char_counter counter{};
+    auto wrapper = fwrap(&counter);
+
+    std::function<vessel_glue> vessel_std_func{ apply_glue<vessel_glue>(wrapper) };
+    auto std_func = convert_to<std::function>(wrapper);
+
+    auto vessel_ref = function_ref<vessel_glue>{ wrapper };
+    auto ref = make_function_ref(wrapper);
+
+    auto int_char = convert_to<std::function>(fwrap(&tests::int_char_func));
+    std::function<const char*(forward<int>, forward<char>)> vessel_int_char{
+        apply_glue<const char*(forward<int>, forward<char>)>(fwrap(&tests::int_char_func)) };
+
+    measure("std::function, forward<int>, forward<char>, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_many(vessel_std_func, calls_per_iteration));
+    });
+
+    measure("std::function, int, char, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_many(std_func, calls_per_iteration));
+    });
+
+    measure("function_ref, forward<int>, forward<char>, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_many(vessel_ref, calls_per_iteration));
+    });
+
+    measure("function_ref, int, char, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_many(ref, calls_per_iteration));
+    });
+
+    measure("int_char_func, forward<int>, forward<char>, 100 calls", iterations, [&](std::size_t) {
+        long result = 0;
+        for (long i = 0; i < calls_per_iteration; ++i) {
+            result += vessel_int_char(static_cast<int>(i), 'c') != nullptr;
+        }
+        do_not_optimize(result);
+    });
+
+    measure("int_char_func, int, char, 100 calls", iterations, [&](std::size_t) {
+        long result = 0;
+        for (long i = 0; i < calls_per_iteration; ++i) {
+            result += int_char(static_cast<int>(i), 'c') != nullptr;
+        }
+        do_not_optimize(result);
+    });
+
+    return 0;
+}
\ No newline at end of file
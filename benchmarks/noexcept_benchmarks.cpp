@@ -0,0 +1,83 @@
+#include "benchmark.h"
+
+#include <string>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Calls noexcept member functions through CLBL wrappers from callers that own
+objects with destructors. When the compiler can see that the call doesn't
+throw, it doesn't need a landing pad to destroy those objects. Build with
+-std=c++17 (noexcept is part of the PMF type). noexcept_sizes.sh compares the
+size of the .text, .eh_frame and .gcc_except_table sections with a build whose
+member functions aren't noexcept (-DCLBL_BENCHMARK_NOEXCEPT=), and with
+-std=c++14, where noexcept can't be propagated.
+*/
+
+#ifndef CLBL_BENCHMARK_NOEXCEPT
+#define CLBL_BENCHMARK_NOEXCEPT noexcept
+#endif
+
+namespace {
+
+    struct accumulator {
+        long total = 0;
+
+        long add(long i) CLBL_BENCHMARK_NOEXCEPT { return total += i; }
+        long add_twice(long i, long j) CLBL_BENCHMARK_NOEXCEPT { return total += i + j; }
+    };
+
+    template<typename Callable>
+    CLBL_BENCHMARK_NOINLINE long call_with_cleanup(Callable& f, long count) {
+        std::string label = "a label that doesn't fit the small string buffer";
+        long result = 0;
+        for (long i = 0; i < count; ++i) {
+            result += f(i);
+        }
+        return result + static_cast<long>(label.size());
+    }
+
+    template<typename Callable>
+    CLBL_BENCHMARK_NOINLINE long call_twice_with_cleanup(Callable& f, long count) {
+        std::string label = "a label that doesn't fit the small string buffer";
+        std::string other = label + label;
+        long result = 0;
+        for (long i = 0; i < count; ++i) {
+            result += f(i, i);
+        }
+        return result + static_cast<long>(other.size());
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 1000000;
+    volatile long calls_per_iteration = 100;
+
+    accumulator acc{};
+    auto add = fwrap(&acc, &accumulator::add);
+    auto add_twice = fwrap(&acc, &accumulator::add_twice);
+    auto add_glue = apply_glue<forwarding_glue<decltype(add)> >(add);
+    auto devirtualized = fwrap(devirtualize, &acc, &accumulator::add);
+
+    std::cout << "is_noexcept: " << is_noexcept<decltype(add)> << std::endl;
+
+    measure("pmf_ptr_wrapper, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_with_cleanup(add, calls_per_iteration));
+    });
+
+    measure("pmf_ptr_wrapper, 2 args, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_twice_with_cleanup(add_twice, calls_per_iteration));
+    });
+
+    measure("glue, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_with_cleanup(add_glue, calls_per_iteration));
+    });
+
+    measure("devirtualized, 100 calls", iterations, [&](std::size_t) {
+        do_not_optimize(call_with_cleanup(devirtualized, calls_per_iteration));
+    });
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Builds noexcept_benchmarks.cpp three ways and prints the size of the sections
+# that noexcept affects:
+#
+#   c++17            - noexcept member functions, propagated through the wrappers
+#   c++17, throwing  - the same member functions without noexcept
+#   c++14            - noexcept member functions, but noexcept isn't part of the
+#                      PMF type, so the wrappers can't propagate it
+#
+# usage: noexcept_sizes.sh [compiler flags...]   (CXX defaults to g++)
+# run it from anywhere - it only writes to a temporary directory
+
+set -e
+
+cxx=${CXX:-g++}
+here=$(cd "$(dirname "$0")" && pwd)
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+
+build() {
+    name=$1
+    shift
+    "$cxx" -O2 -I"$here/../include" "$@" "$here/noexcept_benchmarks.cpp" -o "$out/$name"
+}
+
+build cxx17 -std=c++17 "$@"
+build cxx17_throwing -std=c++17 -DCLBL_BENCHMARK_NOEXCEPT= "$@"
+build cxx14 -std=c++14 "$@"
+
+printf '%-16s %10s %10s %18s %10s\n' build .text .eh_frame .gcc_except_table file
+for name in cxx17 cxx17_throwing cxx14; do
+    size -A "$out/$name" | awk -v name="$name" -v file="$(wc -c < "$out/$name")" '
+        $1 == ".text" { text = $2 }
+        $1 == ".eh_frame" { eh = $2 }
+        $1 == ".gcc_except_table" { table = $2 }
+        END { printf "%-16s %10d %10d %18d %10d\n", name, text, eh, table, file }'
+done
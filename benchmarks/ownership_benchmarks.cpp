@@ -0,0 +1,94 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Several threads hand the same callback to a consumer, once per event. With
+clbl::shared (and clbl::intrusive with an atomic count), each hand-off
+copies the wrapper, so every thread increments and decrements the same
+counter. clbl::borrowed copies a raw pointer, and clbl::unique moves the
+callback along instead of copying it.
+*/
+
+namespace {
+
+    struct handler {
+        std::atomic<long> refs{ 0 };
+
+        long on_event(long e) const {
+            return e * 3 + 1;
+        }
+    };
+
+    inline void intrusive_ptr_add_ref(handler* h) {
+        h->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void intrusive_ptr_release(handler* h) {
+        if (h->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete h;
+        }
+    }
+
+    //takes the callback by value, like a queue or an executor would
+    template<typename Callback>
+    CLBL_BENCHMARK_NOINLINE long deliver(Callback callback, long e) {
+        return callback(e);
+    }
+
+    template<typename Callback>
+    CLBL_BENCHMARK_NOINLINE long deliver_ref(Callback& callback, long e) {
+        return callback(e);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 2000000;
+    auto thread_count = std::max<std::size_t>(2, std::min<std::size_t>(8, std::thread::hardware_concurrency()));
+
+    auto shared_object = std::make_shared<handler>();
+    auto intrusive_object = new handler{};
+
+    auto borrowed_callback = fwrap(borrowed, shared_object, &handler::on_event);
+    auto shared_callback = fwrap(shared, shared_object, &handler::on_event);
+    auto intrusive_callback = fwrap(intrusive, intrusive_object, &handler::on_event);
+
+    std::cout << "sizeof borrowed: " << sizeof(borrowed_callback)
+        << ", shared: " << sizeof(shared_callback)
+        << ", intrusive: " << sizeof(intrusive_callback) << std::endl;
+
+    measure_threads("shared, copy per event", thread_count, iterations, [&](std::size_t, std::size_t i) {
+        do_not_optimize(deliver(shared_callback, static_cast<long>(i)));
+    });
+
+    measure_threads("intrusive (atomic), copy per event", thread_count, iterations, [&](std::size_t, std::size_t i) {
+        do_not_optimize(deliver(intrusive_callback, static_cast<long>(i)));
+    });
+
+    measure_threads("borrowed, copy per event", thread_count, iterations, [&](std::size_t, std::size_t i) {
+        do_not_optimize(deliver(borrowed_callback, static_cast<long>(i)));
+    });
+
+    //each thread owns its callback, so there is nothing to share
+    std::vector<unique_function<long(long)> > unique_callbacks;
+    for (std::size_t t = 0; t < thread_count; ++t) {
+        unique_callbacks.emplace_back(convert_to<unique_function>(
+            fwrap(unique, std::make_unique<handler>(), &handler::on_event)));
+    }
+
+    measure_threads("unique, move per event", thread_count, iterations, [&](std::size_t t, std::size_t i) {
+        auto callback = std::move(unique_callbacks[t]);
+        do_not_optimize(deliver_ref(callback, static_cast<long>(i)));
+        unique_callbacks[t] = std::move(callback);
+    });
+
+    return 0;
+}
\ No newline at end of file
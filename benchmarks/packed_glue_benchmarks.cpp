@@ -0,0 +1,104 @@
+#include "benchmark.h"
+
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares the two calling conventions of clbl::basic_erased_call at arities 0
+to 16 - every argument passed to the thunk as it is, against the arguments
+copied by value into a std::tuple<GlueArgs...> and passed behind one pointer.
+Half of the arguments are longs, which are glued by value, and half are
+std::strings, which are glued through clbl::forward (so the tuple holds the
+vessel, not the string). The third line of each arity times clbl::function_ref, which
+packs above CLBL_PACKED_GLUE_ARITY.
+*/
+
+namespace {
+
+    template<std::size_t I>
+    using arg_t = std::conditional_t<I % 2 == 0, long, const std::string&>;
+
+    inline long weight(long l) { return l; }
+    inline long weight(const std::string& s) { return static_cast<long>(s.size()); }
+
+    template<typename... Args>
+    struct summer {
+        long operator()(Args... args) const {
+            long result = 0;
+            (void)std::initializer_list<int>{ (result += weight(args), 0)... };
+            return result;
+        }
+    };
+
+    template<bool Packed, typename... Args>
+    struct erased {
+        using call_type = basic_erased_call<Packed, long, glue_arg<Args>...>;
+
+        summer<Args...> target;
+        typename call_type::thunk_type thunk = call_type::template thunk_for<summer<Args...> >();
+
+        long operator()(glue_arg<Args>... args) const {
+            return call_type::call(thunk, const_cast<summer<Args...>*>(&target), args...);
+        }
+    };
+
+    template<std::size_t I>
+    inline long make_arg(long i, const std::string&, std::true_type) { return i + I; }
+
+    template<std::size_t I>
+    inline const std::string& make_arg(long, const std::string& s, std::false_type) { return s; }
+
+    template<typename Function, std::size_t... I>
+    CLBL_BENCHMARK_NOINLINE long call_many(const Function& f, long count, const std::string& s,
+        std::index_sequence<I...>) {
+        long result = 0;
+        for (long i = 0; i < count; ++i) {
+            result += f(make_arg<I>(i, s, std::integral_constant<bool, I % 2 == 0>{})...);
+        }
+        return result;
+    }
+
+    template<std::size_t... I>
+    inline void measure_arity(std::size_t iterations, long calls, const std::string& s, std::index_sequence<I...> seq) {
+        erased<false, arg_t<I>...> unpacked{};
+        erased<true, arg_t<I>...> packed{};
+        auto wrapper = fwrap(summer<arg_t<I>...>{});
+        auto ref = make_function_ref(wrapper);
+
+        std::string prefix = std::to_string(sizeof...(I)) + " args, ";
+
+        measure((prefix + "unpacked").c_str(), iterations, [&](std::size_t) {
+            do_not_optimize(call_many(unpacked, calls, s, seq));
+        });
+
+        measure((prefix + "packed").c_str(), iterations, [&](std::size_t) {
+            do_not_optimize(call_many(packed, calls, s, seq));
+        });
+
+        measure((prefix + "function_ref").c_str(), iterations, [&](std::size_t) {
+            do_not_optimize(call_many(ref, calls, s, seq));
+        });
+    }
+
+    template<std::size_t... N>
+    inline void measure_arities(std::size_t iterations, long calls, const std::string& s, std::index_sequence<N...>) {
+        (void)std::initializer_list<int>{ (measure_arity(iterations, calls, s, std::make_index_sequence<N>{}), 0)... };
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 20000;
+    volatile long calls_per_iteration = 100;
+
+    std::string s = "payload";
+
+    measure_arities(iterations, calls_per_iteration, s, std::make_index_sequence<17>{});
+
+    return 0;
+}
\ No newline at end of file
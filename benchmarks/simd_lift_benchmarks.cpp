@@ -0,0 +1,53 @@
+#include "benchmark.h"
+
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Runs a generic arithmetic function object over a batch of floats, one scalar
+call per element (clbl::invoke_batch) against whole clbl::simd packs
+(clbl::simd_lift). Times are per batch. Build with -mavx2 to use 32-byte packs.
+*/
+
+namespace {
+
+    constexpr std::size_t rows = 1 << 16;
+
+    struct transform {
+        template<typename T>
+        T operator()(T x, T y) const { return (x * 0.5f + y) * (x - 1.f) / (y + 2.f); }
+    };
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 2000;
+
+    std::vector<float> x(rows);
+    std::vector<float> y(rows);
+    std::vector<float> out(rows);
+
+    for (std::size_t i = 0; i != rows; ++i) {
+        x[i] = static_cast<float>(i % 100);
+        y[i] = static_cast<float>(i % 7);
+    }
+
+    auto wrapper = fwrap(transform{});
+    auto lifted = simd_lift(wrapper);
+
+    std::cout << "lanes: " << simd_lanes<float> << std::endl;
+
+    measure("clbl::invoke_batch", iterations, [&](std::size_t) {
+        invoke_batch(wrapper, columns(x, y), out);
+        do_not_optimize(out[rows - 1]);
+    });
+
+    measure("clbl::simd_lift", iterations, [&](std::size_t) {
+        lifted(columns(x, y), out);
+        do_not_optimize(out[rows - 1]);
+    });
+
+    return 0;
+}
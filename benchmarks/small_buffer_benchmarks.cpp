@@ -0,0 +1,90 @@
+#include "benchmark.h"
+
+#include <functional>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Compares converting a pmf_ptr_wrapper to std::function when the glue fits
+the small buffer (a raw object pointer, stored as a compressed PMF) against
+the same wrapper around a pointer-like type, whose 24-byte glue spills to
+the heap.
+*/
+
+namespace {
+
+    struct handler {
+        long state[4] = {};
+
+        long on_request(long id, long size) {
+            state[id & 3] += size;
+            return state[id & 3];
+        }
+
+        virtual long on_virtual_request(long id, long size) {
+            return on_request(id, size);
+        }
+    };
+
+    //dereferenceable, but not a raw pointer, so the PMF is stored as it is
+    template<typename T>
+    struct plain_ptr {
+        T* ptr;
+        T& operator*() const { return *ptr; }
+    };
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE long call_once(const Function& f, long id) {
+        return f(id, id * 3);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 10000000;
+
+    handler h{};
+    auto wrapper = fwrap(&h, &handler::on_request);
+    auto virtual_wrapper = fwrap(&h, &handler::on_virtual_request);
+    auto plain_wrapper = fwrap(plain_ptr<handler>{ &h }, &handler::on_request);
+    auto plain_virtual_wrapper = fwrap(plain_ptr<handler>{ &h }, &handler::on_virtual_request);
+
+    std::cout << "raw pointer glue: " << sizeof(glue_type<decltype(wrapper)&>) << " bytes, "
+        << "fits: " << fits_small_buffer<std::function, decltype(wrapper)&> << std::endl;
+    std::cout << "plain_ptr glue: " << sizeof(glue_type<decltype(plain_wrapper)&>) << " bytes, "
+        << "fits: " << fits_small_buffer<std::function, decltype(plain_wrapper)&> << std::endl;
+
+    measure("std::function construct + call (plain_ptr)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(plain_wrapper);
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (raw pointer)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(wrapper);
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (plain_ptr, virtual)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(plain_virtual_wrapper);
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (raw pointer, virtual)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(virtual_wrapper);
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    auto plain = convert_to<std::function>(plain_wrapper);
+    auto compact = convert_to<std::function>(wrapper);
+
+    measure("std::function call (plain_ptr)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(plain, static_cast<long>(i)));
+    });
+
+    measure("std::function call (raw pointer)", iterations, [&](std::size_t i) {
+        do_not_optimize(call_once(compact, static_cast<long>(i)));
+    });
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "benchmark.h"
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+using namespace clbl;
+using namespace clbl::benchmarks;
+
+/*
+Measures what trivially copyable CLBL wrappers buy: std::vector can grow
+with memcpy instead of element-wise copies, and std::function
+implementations that keep small, trivially copyable targets inline
+skip the heap allocation.
+
+as_before_fix wraps the same payload behind a user-provided copy
+constructor, the way every wrapper used to look.
+*/
+
+namespace {
+
+    struct handler {
+        long state[4] = {};
+
+        long on_request(long id, long size) {
+            state[id & 3] += size;
+            return state[id & 3];
+        }
+    };
+
+    template<typename T>
+    struct as_before_fix {
+        T value;
+
+        as_before_fix(const T& v) : value(v) {}
+        as_before_fix(const as_before_fix& other) : value(other.value) {}
+
+        template<typename... Args>
+        auto operator()(Args&&... a) { return value(std::forward<Args>(a)...); }
+    };
+
+    template<typename T>
+    CLBL_BENCHMARK_NOINLINE std::size_t grow(const T& element, std::size_t count) {
+        std::vector<T> v;
+        for (std::size_t i = 0; i < count; ++i) {
+            v.push_back(element);
+        }
+        return v.size();
+    }
+
+    template<typename Function>
+    CLBL_BENCHMARK_NOINLINE long call_once(const Function& f, long id) {
+        return f(id, id * 3);
+    }
+}
+
+int main() {
+
+    constexpr std::size_t iterations = 10000000;
+    constexpr std::size_t growth_iterations = 200;
+    constexpr std::size_t elements = 100000;
+
+    handler h{};
+    auto wrapper = CLBL_PMFWRAP(&handler::on_request, &h);
+    auto pmf_wrapper = fwrap(&h, &handler::on_request);
+    auto glue = apply_glue<forwarding_glue<decltype(wrapper)> >(wrapper);
+    auto old_glue = as_before_fix<decltype(glue)>{ glue };
+
+    static_assert(std::is_trivially_copyable<decltype(wrapper)>::value, "");
+    static_assert(std::is_trivially_copyable<decltype(glue)>::value, "");
+    static_assert(std::is_trivially_copyable<decltype(pmf_wrapper)>::value, "");
+
+    measure("std::vector<wrapper> growth (100000 elements, trivially copyable)", growth_iterations, [&](std::size_t) {
+        do_not_optimize(grow(pmf_wrapper, elements));
+    });
+
+    measure("std::vector<wrapper> growth (100000 elements, user-provided copy)", growth_iterations, [&](std::size_t) {
+        do_not_optimize(grow(as_before_fix<decltype(pmf_wrapper)>{ pmf_wrapper }, elements));
+    });
+
+    measure("std::function construct + call (trivially copyable glue)", iterations, [&](std::size_t i) {
+        auto f = convert_to<std::function>(wrapper);
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    measure("std::function construct + call (user-provided copy)", iterations, [&](std::size_t i) {
+        auto f = std::function<forwarding_glue<decltype(wrapper)> >{ old_glue };
+        do_not_optimize(call_once(f, static_cast<long>(i)));
+    });
+
+    return 0;
+}
\ No newline at end of file
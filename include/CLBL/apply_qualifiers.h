@@ -65,6 +65,30 @@ namespace clbl {
         using apply = const volatile T&;
     };
 
+    template<>
+    struct qualifiers<qflags::rvalue_reference_> {
+        template<typename T>
+        using apply = T&&;
+    };
+
+    template<>
+    struct qualifiers<qflags::const_ | qflags::rvalue_reference_> {
+        template<typename T>
+        using apply = const T&&;
+    };
+
+    template<>
+    struct qualifiers<qflags::volatile_ | qflags::rvalue_reference_> {
+        template<typename T>
+        using apply = volatile T&&;
+    };
+
+    template<>
+    struct qualifiers<qflags::const_ | qflags::volatile_ | qflags::rvalue_reference_> {
+        template<typename T>
+        using apply = const volatile T&&;
+    };
+
     using no_q = qualifiers<qflags::default_>;
     using const_q = qualifiers<qflags::const_>;
     using volatile_q = qualifiers<qflags::volatile_>;
@@ -0,0 +1,74 @@
+#ifndef CLBL_BIND_CONSTANT_H
+#define CLBL_BIND_CONSTANT_H
+
+#include <cstddef>
+#include <utility>
+
+#include <CLBL/utility.h>
+#include <CLBL/bind_front.h>
+
+namespace clbl {
+
+    /*
+    clbl::bind_constant binds compile-time values to the front of a callable's
+    parameter list:
+
+        auto price = clbl::bind_constant<int, 4, 2>(clbl::fwrap(&price_kernel));
+        price(spot); //price_kernel(4, 2, spot)
+
+    Since C++17, the values may have different types: clbl::bind_constant<4, true>(f).
+
+    Each value is bound as an empty object that converts to the value (see
+    clbl::bind_front), so the wrapper stores nothing for it, and every call passes
+    a constant the optimizer can fold into an inlined target.
+    */
+
+    namespace detail {
+
+        //Position keeps equal values distinct, so that each one stays an empty base
+        template<typename T, T Value, std::size_t Position>
+        struct bound_constant {
+            using value_type = T;
+            static constexpr T value = Value;
+
+            inline constexpr operator T() const noexcept {
+                return Value;
+            }
+        };
+
+        template<typename T, T Value, std::size_t Position>
+        constexpr T bound_constant<T, Value, Position>::value;
+
+        template<typename T, T... Values, typename Callable, std::size_t... I>
+        inline constexpr auto
+        bind_constants(Callable&& c, std::index_sequence<I...>) {
+            return bind_front(std::forward<Callable>(c), bound_constant<T, Values, I>{}...);
+        }
+
+#ifdef __cpp_nontype_template_parameter_auto
+        template<auto... Values, typename Callable, std::size_t... I>
+        inline constexpr auto
+        bind_auto_constants(Callable&& c, std::index_sequence<I...>) {
+            return bind_front(std::forward<Callable>(c), bound_constant<decltype(Values), Values, I>{}...);
+        }
+#endif
+    }
+
+    template<typename T, T... Values, typename Callable>
+    inline constexpr auto
+    bind_constant(Callable&& c) {
+        return detail::bind_constants<T, Values...>(std::forward<Callable>(c),
+            std::make_index_sequence<sizeof...(Values)>{});
+    }
+
+#ifdef __cpp_nontype_template_parameter_auto
+    template<auto... Values, typename Callable>
+    inline constexpr auto
+    bind_constant(Callable&& c) {
+        return detail::bind_auto_constants<Values...>(std::forward<Callable>(c),
+            std::make_index_sequence<sizeof...(Values)>{});
+    }
+#endif
+}
+
+#endif
\ No newline at end of file
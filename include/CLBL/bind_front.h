@@ -0,0 +1,71 @@
+#ifndef CLBL_BIND_FRONT_H
+#define CLBL_BIND_FRONT_H
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/utility.h>
+#include <CLBL/fwrap.h>
+#include <CLBL/wrap/bound_function.h>
+
+namespace clbl {
+
+    /*
+    clbl::bind_front binds arguments to the front of a callable's parameter list,
+    and returns a CLBL wrapper for the rest of it:
+
+        auto f = clbl::bind_front(clbl::fwrap(&send), socket, flags);
+        f(buffer, size); //send(socket, flags, buffer, size)
+
+    Callables that aren't CLBL wrappers are wrapped with clbl::fwrap first. The
+    wrapper is stored with the bound arguments inside the new wrapper - no
+    allocation, no indirection, and empty arguments take no space. Arguments are
+    bound by value (pass std::ref to bind a reference). The result works with clbl::harden and clbl::convert_to like
+    any other wrapper, and its signature is deduced from the wrapped callable.
+    Binding to an ambiguous wrapper gives an ambiguous wrapper - clbl::harden
+    then only has to name the remaining signature.
+    */
+
+    namespace detail {
+
+        template<typename Return, typename ArgTypes, std::size_t BoundCount, typename Indices>
+        struct drop_front_t;
+
+        template<typename Return, typename ArgTypes, std::size_t BoundCount, std::size_t... I>
+        struct drop_front_t<Return, ArgTypes, BoundCount, std::index_sequence<I...> > {
+            using type = Return(std::tuple_element_t<BoundCount + I, ArgTypes>...);
+        };
+
+        template<typename Callable, std::size_t BoundCount, bool = is_ambiguous_t<Callable> >
+        struct bound_signature_t {
+            using type = ambiguous_return(ambiguous_args);
+        };
+
+        template<typename Callable, std::size_t BoundCount>
+        struct bound_signature_t<Callable, BoundCount, false> {
+
+            static constexpr auto arity = std::tuple_size<args<Callable> >::value;
+            static_assert(BoundCount <= arity, "clbl::bind_front was given more arguments than the callable takes.");
+
+            using type = typename drop_front_t<result_of<Callable>, args<Callable>,
+                BoundCount, std::make_index_sequence<arity - (BoundCount <= arity ? BoundCount : arity)> >::type;
+        };
+
+        template<typename Callable, std::size_t BoundCount>
+        using bound_signature = typename bound_signature_t<Callable, BoundCount>::type;
+    }
+
+    template<typename Callable, typename... BoundArgs>
+    inline constexpr auto
+    bind_front(Callable&& c, BoundArgs&&... args) {
+        using wrapped = std::decay_t<decltype(detail::fwrap_unless_clbl(std::forward<Callable>(c)))>;
+        using function_type = detail::bound_signature<wrapped, sizeof...(BoundArgs)>;
+        return bound_function<function_type>::template
+            wrap<qflags::default_>(detail::fwrap_unless_clbl(std::forward<Callable>(c)), std::forward<BoundArgs>(args)...);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -4,9 +4,22 @@
 #include <CLBL/utility.h>
 #include <CLBL/tags.h>
 #include <CLBL/try_call.h>
+#include <CLBL/ownership.h>
 #include <CLBL/fwrap.h>
 #include <CLBL/convert_to.h>
+#include <CLBL/function_ref.h>
+#include <CLBL/inline_function.h>
+#include <CLBL/unique_function.h>
+#include <CLBL/fits_small_buffer.h>
 #include <CLBL/harden.h>
+#include <CLBL/bind_front.h>
+#include <CLBL/bind_constant.h>
+#include <CLBL/compose.h>
+#include <CLBL/decorate.h>
+#include <CLBL/invoke_batch.h>
+#include <CLBL/simd_lift.h>
+#include <CLBL/for_each_member.h>
+#include <CLBL/executor.h>
 #include <CLBL/forward.h>
 
 #endif
\ No newline at end of file
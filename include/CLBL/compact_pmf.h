@@ -0,0 +1,112 @@
+#ifndef CLBL_COMPACT_PMF_H
+#define CLBL_COMPACT_PMF_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/*
+CLBL_COMPACT_PMF is defined to 1 on platforms that use the Itanium C++ ABI
+representation of member function pointers, and where a member function can
+be called through a plain function pointer that takes "this" as its first
+parameter. Define CLBL_COMPACT_PMF to 0 before including CLBL to opt out.
+*/
+#ifndef CLBL_COMPACT_PMF
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32) \
+    && (defined(__x86_64__) || defined(__aarch64__))
+#define CLBL_COMPACT_PMF 1
+#else
+#define CLBL_COMPACT_PMF 0
+#endif
+#endif
+
+namespace clbl { namespace detail {
+
+    /*
+    A compact PMF is a PMF split into
+
+         - code: the address of a non-virtual member function, or the
+           vtable offset + 1 of a virtual one (the x86-64 encoding)
+         - the "this" adjustment, which is applied to the object pointer
+           once instead of on every call
+
+    Only a class without virtual functions is guaranteed a non-virtual code,
+    which compact_pmf_function turns into a plain function pointer. Otherwise,
+    resolve_compact_pmf looks up the vtable of the object for a virtual code.
+    */
+
+    struct itanium_pmf {
+        std::uintptr_t ptr;
+        std::ptrdiff_t adj;
+    };
+
+    template<typename TMemberFnPtr>
+    inline itanium_pmf to_itanium_pmf(TMemberFnPtr pmf) {
+        static_assert(sizeof(TMemberFnPtr) == sizeof(itanium_pmf),
+            "Unexpected member function pointer representation. Define CLBL_COMPACT_PMF to 0.");
+        itanium_pmf raw;
+        std::memcpy(&raw, &pmf, sizeof(raw));
+        return raw;
+    }
+
+    template<typename TMemberFnPtr>
+    inline std::uintptr_t compact_pmf_code(TMemberFnPtr pmf) {
+        auto raw = to_itanium_pmf(pmf);
+#if defined(__aarch64__)
+        //ARM keeps the virtual flag in the low bit of adj, and ptr holds the plain vtable offset
+        return (raw.adj & 1) != 0 ? raw.ptr + 1 : raw.ptr;
+#else
+        return raw.ptr;
+#endif
+    }
+
+    //the adjusted "this" - a null object stays null, like a null pointer converted to a base
+    template<typename TMemberFnPtr, typename T>
+    inline void* compact_pmf_object(TMemberFnPtr pmf, T* object) {
+        auto raw = to_itanium_pmf(pmf);
+#if defined(__aarch64__)
+        auto adjustment = raw.adj >> 1;
+#else
+        auto adjustment = raw.adj;
+#endif
+        auto bytes = const_cast<char*>(reinterpret_cast<const volatile char*>(object));
+        return object == nullptr ? nullptr : bytes + adjustment;
+    }
+
+    template<typename Return, typename... Args, typename TMemberFnPtr>
+    inline auto compact_pmf_function(TMemberFnPtr pmf) {
+        using code_type = Return(*)(void*, Args...);
+        return reinterpret_cast<code_type>(compact_pmf_code(pmf));
+    }
+
+    template<typename Return, typename... Args>
+    inline auto resolve_compact_pmf(std::uintptr_t code, const volatile void* object) {
+        using code_type = Return(*)(void*, Args...);
+        if (code & 1) {
+            auto vtable = *static_cast<const char* const*>(const_cast<const void*>(object));
+            return *reinterpret_cast<const code_type*>(vtable + code - 1);
+        }
+        return reinterpret_cast<code_type>(code);
+    }
+
+    /*
+    compact_pmf_invocation is the clbl::convert_to glue of a PMF bound to a raw pointer
+    to a polymorphic class. It is 16 bytes instead of 24, so it fits std::function's
+    small buffer. Whether the PMF is virtual is only known at run time, so each call
+    checks - a predictable branch costs much less than the allocation it saves.
+    */
+    template<bool IsNoexcept, typename Return, typename... Args>
+    struct compact_pmf_invocation {
+        std::uintptr_t code;
+        void* object;
+
+        template<typename... Fargs>
+        inline Return operator()(Fargs&&... a) const noexcept(IsNoexcept) {
+            return resolve_compact_pmf<Return, Args...>(code, object)(object, std::forward<Fargs>(a)...);
+        }
+    };
+}}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+#ifndef CLBL_COMPOSE_H
+#define CLBL_COMPOSE_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/utility.h>
+#include <CLBL/fwrap.h>
+#include <CLBL/wrap/composed_function.h>
+
+namespace clbl {
+
+    /*
+    clbl::compose chains callables into a pipeline, in the order they are called:
+
+        auto price = clbl::compose(&parse, &normalize, &quote);
+        price(line); //quote(normalize(parse(line)))
+
+    Callables that aren't CLBL wrappers are wrapped with clbl::fwrap first. The
+    stages are stored side by side in one wrapper, with a single operator() that
+    calls them all, so the result of each stage goes straight into the next one
+    as a prvalue - converting the pipeline with clbl::convert_to gives one
+    std::function, instead of one per stage.
+
+    When two neighbouring stages are unambiguous, the return_type of the first one
+    is checked against the arg_types of the second at compile time. The pipeline
+    takes the parameters of its first stage, and is ambiguous (until clbl::harden
+    is called) when its first stage is.
+    */
+
+    namespace detail {
+
+        template<typename ArgTypes, bool = std::tuple_size<ArgTypes>::value == 1>
+        struct single_arg_t {
+            using type = void;
+        };
+
+        template<typename ArgTypes>
+        struct single_arg_t<ArgTypes, true> {
+            using type = std::tuple_element_t<0, ArgTypes>;
+        };
+
+        template<typename From, typename To, bool = is_ambiguous_t<From> || is_ambiguous_t<To> >
+        struct stage_link {
+            static constexpr bool value = true;
+        };
+
+        template<typename From, typename To>
+        struct stage_link<From, To, false> {
+
+            static_assert(std::tuple_size<args<To> >::value == 1,
+                "clbl::compose: every stage after the first must take exactly one argument.");
+
+            static_assert(std::tuple_size<args<To> >::value != 1
+                || std::is_convertible<result_of<From>, typename single_arg_t<args<To> >::type>::value,
+                "clbl::compose: the return type of a stage doesn't convert to the argument of the next one.");
+
+            static constexpr bool value = true;
+        };
+
+        template<typename Stages, typename Indices = std::make_index_sequence<std::tuple_size<Stages>::value - 1> >
+        struct stage_links;
+
+        template<typename Stages, std::size_t... I>
+        struct stage_links<Stages, std::index_sequence<I...> > {
+            //each link static_asserts on its own, so instantiating them is the check
+            using links = std::integer_sequence<bool,
+                stage_link<std::tuple_element_t<I, Stages>, std::tuple_element_t<I + 1, Stages> >::value...>;
+            static constexpr bool value = true;
+        };
+
+        template<typename Result, typename = void>
+        struct has_stage_result : std::false_type {};
+
+        template<typename Result>
+        struct has_stage_result<Result, std::conditional_t<true, void, typename Result::type> > : std::true_type {};
+
+        struct missing_stage_result {
+            using type = ambiguous_return;
+        };
+
+        template<typename Data, typename ArgTypes>
+        struct composed_signature_from;
+
+        template<typename Data, typename... Args>
+        struct composed_signature_from<Data, std::tuple<Args...> > {
+
+            using result = composed_stage_result<qflags::default_, Data&, Data::stage_count - 1, std::tuple<Args...> >;
+
+            static_assert(has_stage_result<result>::value,
+                "clbl::compose: a stage can't be called with the result of the stage before it.");
+
+            using type = typename std::conditional_t<has_stage_result<result>::value,
+                result, missing_stage_result>::type(Args...);
+        };
+
+        template<typename Data, typename First, bool = is_ambiguous_t<First> >
+        struct composed_signature_t {
+            using type = ambiguous_return(ambiguous_args);
+        };
+
+        template<typename Data, typename First>
+        struct composed_signature_t<Data, First, false> : composed_signature_from<Data, args<First> > {};
+    }
+
+    template<typename... Stages>
+    inline constexpr auto
+    compose(Stages&&... stages) {
+        static_assert(sizeof...(Stages) > 0, "clbl::compose needs at least one stage.");
+        using wrapped = std::tuple<std::decay_t<decltype(detail::fwrap_unless_clbl(std::forward<Stages>(stages)))>...>;
+        static_assert(detail::stage_links<wrapped>::value, "clbl::compose: incompatible stages.");
+        using data_type = composed_invocation_data<
+            std::decay_t<decltype(detail::fwrap_unless_clbl(std::forward<Stages>(stages)))>...>;
+        using function_type = typename detail::composed_signature_t<data_type, std::tuple_element_t<0, wrapped> >::type;
+        return composed_function<function_type>::template
+            wrap<qflags::default_>(detail::fwrap_unless_clbl(std::forward<Stages>(stages))...);
+    }
+}
+
+#endif
\ No newline at end of file
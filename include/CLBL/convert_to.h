@@ -1,4 +1,7 @@
-#include<functional>
+#ifndef CLBL_CONVERT_TO_H
+#define CLBL_CONVERT_TO_H
+
+#include <functional>
 #include <type_traits>
 
 #include <CLBL/tags.h>
@@ -18,6 +21,15 @@ namespace clbl {
     std::function by (ultimately) using clbl::forward to prevent copies
     while the arguments travel from
     std::function -> clbl wrapper -> original callable type
+
+    When the wrapper is an rvalue, its invocation data is moved into the
+    glue instead of being copied, which also allows move-only targets like
+    clbl::unique_function to take ownership of move-only objects (e.g. a
+    wrapped std::unique_ptr)
+
+    Wrappers may also offer a compact_invocation, which apply_glue prefers
+    over copy_invocation when it is available. See clbl::fits_small_buffer
+    to check at compile time that a conversion doesn't allocate.
     */
 
     namespace detail {
@@ -27,19 +39,42 @@ namespace clbl {
             static_assert(sizeof(BadGlueType) < 0, "Invalid template arguments.");
         };
 
-        template<typename Callable, typename Return, typename... GlueArgs>
-        struct apply_glue_t<Callable, Return(GlueArgs...)> {
-            invocation_copy<Callable> invocation;
-            inline Return operator()(GlueArgs... args) { return invocation(args...); }
+        template<typename Invocation, typename Return, typename... GlueArgs>
+        struct apply_glue_t<Invocation, Return(GlueArgs...)> {
+            Invocation invocation;
+            inline Return operator()(GlueArgs... args) noexcept(noexcept(invocation(args...))) { return invocation(args...); }
         };
     }
 
+    namespace detail {
+
+        //wrappers that can store their invocation more compactly provide compact_invocation
+        template<typename Callable>
+        constexpr inline auto make_invocation(Callable&& c, int)
+            -> decltype(no_ref<Callable>::compact_invocation(std::forward<Callable>(c))) {
+            return no_ref<Callable>::compact_invocation(std::forward<Callable>(c));
+        }
+
+        template<typename Callable>
+        constexpr inline auto make_invocation(Callable&& c, long) {
+            return no_ref<Callable>::copy_invocation(std::forward<Callable>(c));
+        }
+    }
+
     template<typename GlueType, typename Callable>
     constexpr inline auto apply_glue(Callable&& c) {
-        using C = no_ref<Callable>;
-        return detail::apply_glue_t<C, GlueType>{C::copy_invocation(c)};
+        using invocation = decltype(detail::make_invocation(std::forward<Callable>(c), 0));
+        return detail::apply_glue_t<invocation, GlueType>{detail::make_invocation(std::forward<Callable>(c), 0)};
     }
 
+    /*
+    clbl::glue_type is the type of the object that clbl::convert_to hands to the
+    type-erased function template for a Callable. Pass an lvalue reference type
+    to get the glue for an lvalue conversion.
+    */
+    template<typename Callable>
+    using glue_type = decltype(apply_glue<forwarding_glue<Callable> >(std::declval<Callable>()));
+
     template<template<class> class TypeErasedFunctionTemplate, typename Callable>
     inline auto convert_to(Callable&& c) {
 
@@ -49,4 +84,6 @@ namespace clbl {
         using glue = typename no_ref<Callable>::forwarding_glue;
         return TypeErasedFunctionTemplate<glue> { apply_glue<glue>(std::forward<Callable>(c)) };
     }
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
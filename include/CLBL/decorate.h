@@ -0,0 +1,186 @@
+#ifndef CLBL_DECORATE_H
+#define CLBL_DECORATE_H
+
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/utility.h>
+#include <CLBL/fwrap.h>
+#include <CLBL/invocation_data.h>
+#include <CLBL/wrap/decorated_function.h>
+
+namespace clbl {
+
+    /*
+    clbl::decorate wraps a callable in layers of middleware, without type erasure:
+
+        auto checked = clbl::decorate(clbl::fwrap(&transfer),
+            clbl::before(log_call),
+            clbl::advice_if<collect_metrics>(timer{}),
+            validate{});
+
+        checked(from, to, amount); //log_call, then timer, then validate, then transfer
+
+    Each advice object is an "around" advice - it is called as advice(next, args...),
+    and decides whether, when and how to call next(args...), which calls the next
+    layer, and finally the decorated callable. clbl::before and clbl::after build
+    advice objects from plain callables.
+
+    The advice objects are stored inline in the new wrapper, and every layer is a
+    direct call, so the whole stack can inline into the call site. An advice object
+    disabled with clbl::advice_if is an empty pass-through, which takes no space
+    and compiles out. The result has the same type and arg_types as the decorated
+    callable (which is wrapped with clbl::fwrap first, unless it is already a CLBL
+    wrapper), selects CV overloads the same way, and works with clbl::harden and
+    clbl::convert_to like any other wrapper.
+    */
+
+    namespace detail {
+
+        struct pass_through_advice {
+
+            template<typename Next, typename... Args>
+            inline constexpr decltype(auto) operator()(Next&& next, Args&&... a) const volatile
+                noexcept(noexcept(std::forward<Next>(next)(std::forward<Args>(a)...))) {
+                return std::forward<Next>(next)(std::forward<Args>(a)...);
+            }
+        };
+
+        //calls f with the arguments (as const lvalues), then next
+        template<typename F, typename Next, typename... Args>
+        inline constexpr auto call_before(F&& f, Next&& next, Args&&... a)
+            -> decltype(void(f(static_cast<const no_ref<Args>&>(a)...)), std::forward<Next>(next)(std::forward<Args>(a)...)) {
+            f(static_cast<const no_ref<Args>&>(a)...);
+            return std::forward<Next>(next)(std::forward<Args>(a)...);
+        }
+
+        template<typename Result>
+        using after_kind = std::integral_constant<int, std::is_void<Result>::value ? 0
+            : std::is_rvalue_reference<Result>::value ? 2 : 1>;
+
+        //void results
+        template<typename Result, typename F, typename Next, typename... Args>
+        inline constexpr auto finish_after(std::integral_constant<int, 0>, F&& f, Next&& next, Args&&... a)
+            -> return_if_valid<void, decltype(f())> {
+            std::forward<Next>(next)(std::forward<Args>(a)...);
+            f();
+        }
+
+        //values and lvalue references (values are returned with NRVO)
+        template<typename Result, typename F, typename Next, typename... Args>
+        inline constexpr auto finish_after(std::integral_constant<int, 1>, F&& f, Next&& next, Args&&... a)
+            -> return_if_valid<Result, decltype(f(std::declval<const no_ref<Result>&>()))> {
+            Result r = std::forward<Next>(next)(std::forward<Args>(a)...);
+            f(static_cast<const no_ref<Result>&>(r));
+            return r;
+        }
+
+        //rvalue references
+        template<typename Result, typename F, typename Next, typename... Args>
+        inline constexpr auto finish_after(std::integral_constant<int, 2>, F&& f, Next&& next, Args&&... a)
+            -> return_if_valid<Result, decltype(f(std::declval<const no_ref<Result>&>()))> {
+            Result r = std::forward<Next>(next)(std::forward<Args>(a)...);
+            f(static_cast<const no_ref<Result>&>(r));
+            return std::move(r);
+        }
+
+        //calls next, then f with the result (as a const lvalue), or with nothing for void results
+        template<typename F, typename Next, typename... Args,
+            typename Result = decltype(std::declval<Next>()(std::declval<Args>()...))>
+        inline constexpr auto call_after(F&& f, Next&& next, Args&&... a)
+            -> decltype(finish_after<Result>(after_kind<Result>{}, f, std::forward<Next>(next), std::forward<Args>(a)...)) {
+            return finish_after<Result>(after_kind<Result>{}, f, std::forward<Next>(next), std::forward<Args>(a)...);
+        }
+
+        /*
+        The callable is held like a bound argument, so empty callables take no space.
+        Like pass_through_advice, before_advice and after_advice can be called through
+        a volatile decorated wrapper - the callable is then called as const volatile,
+        so those calls only compile for callables that allow it.
+        */
+        template<typename F>
+        struct before_advice : bound_element<0, F> {
+
+            using base_type = bound_element<0, F>;
+
+            template<typename U>
+            inline constexpr before_advice(dummy d, U&& f)
+                : base_type(d, std::forward<U>(f))
+            {}
+
+            template<typename Next, typename... Args>
+            inline constexpr auto operator()(Next&& next, Args&&... a) const
+                -> decltype(call_before(std::declval<const F&>(), std::forward<Next>(next), std::forward<Args>(a)...)) {
+                return call_before(base_type::get(*this), std::forward<Next>(next), std::forward<Args>(a)...);
+            }
+
+            template<typename Next, typename... Args>
+            inline constexpr auto operator()(Next&& next, Args&&... a) const volatile
+                -> decltype(call_before(std::declval<const volatile F&>(), std::forward<Next>(next), std::forward<Args>(a)...)) {
+                return call_before(base_type::get(*this), std::forward<Next>(next), std::forward<Args>(a)...);
+            }
+        };
+
+        template<typename F>
+        struct after_advice : bound_element<0, F> {
+
+            using base_type = bound_element<0, F>;
+
+            template<typename U>
+            inline constexpr after_advice(dummy d, U&& f)
+                : base_type(d, std::forward<U>(f))
+            {}
+
+            template<typename Next, typename... Args>
+            inline constexpr auto operator()(Next&& next, Args&&... a) const
+                -> decltype(call_after(std::declval<const F&>(), std::forward<Next>(next), std::forward<Args>(a)...)) {
+                return call_after(base_type::get(*this), std::forward<Next>(next), std::forward<Args>(a)...);
+            }
+
+            template<typename Next, typename... Args>
+            inline constexpr auto operator()(Next&& next, Args&&... a) const volatile
+                -> decltype(call_after(std::declval<const volatile F&>(), std::forward<Next>(next), std::forward<Args>(a)...)) {
+                return call_after(base_type::get(*this), std::forward<Next>(next), std::forward<Args>(a)...);
+            }
+        };
+    }
+
+    //clbl::before(f) calls f with the arguments (as const lvalues), then the next layer
+    template<typename F>
+    inline constexpr auto
+    before(F&& f) {
+        return detail::before_advice<std::decay_t<F> >{ dummy{}, std::forward<F>(f) };
+    }
+
+    //clbl::after(f) calls the next layer, then f with the result (as a const lvalue), or with nothing for void results
+    template<typename F>
+    inline constexpr auto
+    after(F&& f) {
+        return detail::after_advice<std::decay_t<F> >{ dummy{}, std::forward<F>(f) };
+    }
+
+    //clbl::advice_if<false> replaces an advice object with an empty pass-through
+    template<bool Enabled, typename Advice, std::enable_if_t<Enabled, dummy>* = nullptr>
+    inline constexpr std::decay_t<Advice>
+    advice_if(Advice&& advice) {
+        return std::forward<Advice>(advice);
+    }
+
+    template<bool Enabled, typename Advice, std::enable_if_t<!Enabled, dummy>* = nullptr>
+    inline constexpr detail::pass_through_advice
+    advice_if(Advice&&) {
+        return {};
+    }
+
+    template<typename Callable, typename... Advice>
+    inline constexpr auto
+    decorate(Callable&& c, Advice&&... advice) {
+        using wrapped = std::decay_t<decltype(detail::fwrap_unless_clbl(std::forward<Callable>(c)))>;
+        return decorated_function<typename wrapped::type>::template
+            wrap<qflags::default_>(detail::fwrap_unless_clbl(std::forward<Callable>(c)), std::forward<Advice>(advice)...);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef CLBL_ERASED_CALL_H
+#define CLBL_ERASED_CALL_H
+
+#include <tuple>
+#include <utility>
+
+/*
+CLBL_PACKED_GLUE_ARITY is the largest number of glue arguments that are passed
+through a type-erased call one by one. Define it before including CLBL to change it.
+The default comes from benchmarks/packed_glue_benchmarks.cpp, where packing is no
+faster up to 8 arguments, and faster from 9 on.
+*/
+#ifndef CLBL_PACKED_GLUE_ARITY
+#define CLBL_PACKED_GLUE_ARITY 8
+#endif
+
+namespace clbl {
+
+    /*
+    clbl::erased_call is the calling convention between the operator() of the CLBL
+    type-erased functions (clbl::function_ref, clbl::inline_function and
+    clbl::unique_function) and the thunk that calls the stored target.
+
+    Up to CLBL_PACKED_GLUE_ARITY arguments are passed to the thunk as they are. For
+    wider signatures, most of those arguments wouldn't fit in registers anyway, so
+    instead of spilling each one to the stack on both sides of the call, operator()
+    copies them into a single struct on its own stack, and the thunk receives one
+    pointer to it. Glue arguments are always cheap to copy - a small trivially
+    copyable value or a clbl::forward vessel - so the struct is just the arguments
+    laid out contiguously, and the thunk reads each one once.
+
+    clbl::basic_erased_call takes the choice as a parameter, for code that needs to
+    compare both conventions.
+    */
+
+    template<bool Packed, typename Return, typename... GlueArgs>
+    struct basic_erased_call;
+
+    template<typename Return, typename... GlueArgs>
+    using erased_call = basic_erased_call<(sizeof...(GlueArgs) > CLBL_PACKED_GLUE_ARITY), Return, GlueArgs...>;
+
+    template<typename Return, typename... GlueArgs>
+    struct basic_erased_call<false, Return, GlueArgs...> {
+
+        static constexpr bool is_packed = false;
+
+        using thunk_type = Return(*)(void*, GlueArgs...);
+
+        template<typename F>
+        static inline constexpr thunk_type thunk_for() {
+            return &invoke<F>;
+        }
+
+        static inline Return call(thunk_type thunk, void* target, GlueArgs&... args) {
+            return thunk(target, args...);
+        }
+
+    private:
+
+        template<typename F>
+        static inline Return invoke(void* target, GlueArgs... args) {
+            return (*static_cast<F*>(target))(args...);
+        }
+    };
+
+    template<typename Return, typename... GlueArgs>
+    struct basic_erased_call<true, Return, GlueArgs...> {
+
+        static constexpr bool is_packed = true;
+
+        using pack_type = std::tuple<GlueArgs...>;
+        using thunk_type = Return(*)(void*, pack_type*);
+
+        template<typename F>
+        static inline constexpr thunk_type thunk_for() {
+            return &invoke<F>;
+        }
+
+        static inline Return call(thunk_type thunk, void* target, GlueArgs&... args) {
+            pack_type pack{ args... };
+            return thunk(target, &pack);
+        }
+
+    private:
+
+        template<typename F>
+        static inline Return invoke(void* target, pack_type* pack) {
+            return unpack<F>(target, *pack, std::index_sequence_for<GlueArgs...>{});
+        }
+
+        template<typename F, std::size_t... I>
+        static inline Return unpack(void* target, pack_type& pack, std::index_sequence<I...>) {
+            return (*static_cast<F*>(target))(std::get<I>(pack)...);
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,499 @@
+#ifndef CLBL_EXECUTOR_H
+#define CLBL_EXECUTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <CLBL/tags.h>
+#include <CLBL/utility.h>
+#include <CLBL/fwrap.h>
+#include <CLBL/bind_front.h>
+
+/*
+CLBL_TASK_SLOT_BYTES is the size of a clbl::executor task slot (a cache line by
+default), including the pointer to its operations. Define it before including
+CLBL to change it.
+*/
+#ifndef CLBL_TASK_SLOT_BYTES
+#define CLBL_TASK_SLOT_BYTES 64
+#endif
+
+namespace clbl {
+
+    /*
+    clbl::executor is a thread pool that runs CLBL wrappers as tasks:
+
+        clbl::executor pool{};                      //one worker per hardware thread
+        pool.submit(clbl::fwrap(&obj, &T::tick));   //any CLBL wrapper...
+        pool.submit(&process, chunk, size);         //...or callable, with arguments
+        pool.wait_idle();
+
+    A task is the copy_invocation of the wrapper (after clbl::bind_front, when there
+    are arguments), stored in a fixed-size slot of CLBL_TASK_SLOT_BYTES bytes - no
+    std::function, no allocation, and one indirect call to run it. Tasks that
+    don't fit (or can throw while moving) get a block from a pool of size classes,
+    which is reused instead of going back to the allocator.
+
+    Each worker owns a deque of slots. Tasks submitted by a worker go to its own
+    deque, and the others are spread over the workers in turn. A worker runs its
+    newest task first, and when its deque is empty, it steals the oldest task of
+    another worker. Idle workers sleep until there is work.
+
+    A task that throws calls std::terminate. wait_idle must not be called from a
+    task. The destructor runs every task that was submitted, then stops the workers.
+    */
+
+    namespace detail {
+
+        /*
+        task_pool recycles the heap blocks of oversized tasks, in power-of-two size
+        classes from 128 to 1024 bytes. Larger tasks use operator new directly.
+        */
+        struct task_pool {
+
+            static constexpr std::size_t smallest_block = 128;
+            static constexpr std::size_t class_count = 4;
+
+            struct free_list {
+                std::mutex mutex;
+                std::vector<void*> blocks;
+
+                inline ~free_list() {
+                    for (auto block : blocks)
+                        ::operator delete(block);
+                }
+            };
+
+            free_list classes[class_count];
+
+            static inline std::size_t class_of(std::size_t bytes) {
+                std::size_t c = 0;
+                for (auto size = smallest_block; size < bytes; size *= 2)
+                    ++c;
+                return c;
+            }
+
+            inline void* allocate(std::size_t bytes) {
+                auto c = class_of(bytes);
+                if (c >= class_count)
+                    return ::operator new(bytes);
+                {
+                    std::lock_guard<std::mutex> lock{ classes[c].mutex };
+                    if (!classes[c].blocks.empty()) {
+                        auto block = classes[c].blocks.back();
+                        classes[c].blocks.pop_back();
+                        return block;
+                    }
+                }
+                return ::operator new(smallest_block << c);
+            }
+
+            inline void deallocate(void* block, std::size_t bytes) {
+                auto c = class_of(bytes);
+                if (c >= class_count) {
+                    ::operator delete(block);
+                    return;
+                }
+                std::lock_guard<std::mutex> lock{ classes[c].mutex };
+                classes[c].blocks.push_back(block);
+            }
+
+            static inline task_pool& instance() {
+                static task_pool pool;
+                return pool;
+            }
+        };
+
+        /*
+        task is one slot. copy_invocation results that fit are stored in the slot;
+        the rest are stored in a task_pool block, and the slot holds the pointer.
+        relocate and destroy are left null when memcpy and nothing will do.
+        */
+        struct task {
+
+            static constexpr std::size_t capacity = CLBL_TASK_SLOT_BYTES - sizeof(void*);
+
+            template<typename F>
+            static constexpr bool fits_inline = sizeof(F) <= capacity
+                && alignof(F) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible<F>::value;
+
+            inline task() noexcept
+                : ops{ nullptr }
+            {}
+
+            template<typename F, std::enable_if_t<fits_inline<std::decay_t<F> >, dummy>* = nullptr>
+            inline explicit task(F&& f)
+                : ops{ &inline_operations<std::decay_t<F> >() } {
+                ::new (static_cast<void*>(storage)) std::decay_t<F>(std::forward<F>(f));
+            }
+
+            template<typename F, std::enable_if_t<!fits_inline<std::decay_t<F> >, dummy>* = nullptr>
+            inline explicit task(F&& f)
+                : ops{ &pooled_operations<std::decay_t<F> >() } {
+                using target = std::decay_t<F>;
+                static_assert(alignof(target) <= alignof(std::max_align_t),
+                    "Over-aligned callables cannot be submitted to a clbl::executor.");
+                auto block = task_pool::instance().allocate(sizeof(target));
+                try {
+                    auto p = ::new (block) target(std::forward<F>(f));
+                    std::memcpy(storage, &p, sizeof(p));
+                }
+                catch (...) {
+                    task_pool::instance().deallocate(block, sizeof(target));
+                    throw;
+                }
+            }
+
+            inline task(task&& other) noexcept
+                : ops{ other.ops } {
+                relocate_from(other);
+            }
+
+            inline task& operator=(task&& other) noexcept {
+                if (this != &other) {
+                    reset();
+                    ops = other.ops;
+                    relocate_from(other);
+                }
+                return *this;
+            }
+
+            task(const task&) = delete;
+            task& operator=(const task&) = delete;
+
+            inline ~task() {
+                reset();
+            }
+
+            //runs the task, then destroys it
+            inline void operator()() noexcept {
+                ops->run(storage);
+                reset();
+            }
+
+            inline explicit operator bool() const noexcept {
+                return ops != nullptr;
+            }
+
+        private:
+
+            struct operations {
+                void(*run)(void*);
+                void(*relocate)(void*, void*);
+                void(*destroy)(void*);
+            };
+
+            template<typename F>
+            struct inline_target {
+
+                static inline void run(void* s) {
+                    (*static_cast<F*>(s))();
+                }
+
+                static inline void relocate(void* to, void* from) {
+                    ::new (to) F(std::move(*static_cast<F*>(from)));
+                    static_cast<F*>(from)->~F();
+                }
+
+                static inline void destroy(void* s) {
+                    static_cast<F*>(s)->~F();
+                }
+            };
+
+            template<typename F>
+            struct pooled_target {
+
+                static inline F* get(void* s) {
+                    F* p;
+                    std::memcpy(&p, s, sizeof(p));
+                    return p;
+                }
+
+                static inline void run(void* s) {
+                    (*get(s))();
+                }
+
+                static inline void destroy(void* s) {
+                    auto p = get(s);
+                    p->~F();
+                    task_pool::instance().deallocate(p, sizeof(F));
+                }
+            };
+
+            template<typename F>
+            static inline const operations& inline_operations() {
+                static const operations ops = {
+                    &inline_target<F>::run,
+                    is_trivially_relocatable<F> ? nullptr : &inline_target<F>::relocate,
+                    std::is_trivially_destructible<F>::value ? nullptr : &inline_target<F>::destroy
+                };
+                return ops;
+            }
+
+            template<typename F>
+            static inline const operations& pooled_operations() {
+                static const operations ops = { &pooled_target<F>::run, nullptr, &pooled_target<F>::destroy };
+                return ops;
+            }
+
+            inline void relocate_from(task& other) noexcept {
+                if (ops == nullptr) return;
+                if (ops->relocate == nullptr) std::memcpy(storage, other.storage, capacity);
+                else ops->relocate(storage, other.storage);
+                other.ops = nullptr;
+            }
+
+            inline void reset() noexcept {
+                if (ops != nullptr && ops->destroy != nullptr)
+                    ops->destroy(storage);
+                ops = nullptr;
+            }
+
+            alignas(std::max_align_t) unsigned char storage[capacity];
+            const operations* ops;
+        };
+
+        /*
+        task_deque is a ring buffer of task slots. The owner pushes and pops at the
+        back, and thieves take from the front. It only allocates when it grows.
+        */
+        struct task_deque {
+
+            inline task_deque()
+                : slots(initial_capacity), head{ 0 }, count{ 0 }
+            {}
+
+            inline void push_back(task&& t) {
+                std::lock_guard<std::mutex> lock{ mutex };
+                if (count == slots.size())
+                    grow();
+                slots[(head + count) & (slots.size() - 1)] = std::move(t);
+                ++count;
+            }
+
+            inline bool pop_back(task& t) {
+                std::lock_guard<std::mutex> lock{ mutex };
+                if (count == 0)
+                    return false;
+                --count;
+                t = std::move(slots[(head + count) & (slots.size() - 1)]);
+                return true;
+            }
+
+            inline bool steal_front(task& t) {
+                std::lock_guard<std::mutex> lock{ mutex };
+                if (count == 0)
+                    return false;
+                t = std::move(slots[head]);
+                head = (head + 1) & (slots.size() - 1);
+                --count;
+                return true;
+            }
+
+        private:
+
+            static constexpr std::size_t initial_capacity = 256;
+
+            inline void grow() {
+                std::vector<task> bigger(slots.size() * 2);
+                for (std::size_t i = 0; i != count; ++i)
+                    bigger[i] = std::move(slots[(head + i) & (slots.size() - 1)]);
+                slots.swap(bigger);
+                head = 0;
+            }
+
+            std::mutex mutex;
+            std::vector<task> slots;
+            std::size_t head;
+            std::size_t count;
+        };
+    }
+
+    struct executor {
+
+        inline explicit executor(std::size_t thread_count = default_thread_count())
+            : queued{ 0 }, unfinished{ 0 }, sleepers{ 0 }, next{ 0 }, stopping{ false } {
+            //statics are destroyed in reverse order of construction, so building the pool
+            //here keeps it alive until after ~executor has run, even for a static executor
+            detail::task_pool::instance();
+
+            thread_count = std::max<std::size_t>(1, thread_count);
+            for (std::size_t i = 0; i != thread_count; ++i)
+                workers.emplace_back(std::make_unique<detail::task_deque>());
+
+            //workers that already started are stopped before a failed spawn is rethrown
+            try {
+                for (std::size_t i = 0; i != thread_count; ++i)
+                    threads.emplace_back([this, i] { work(i); });
+            }
+            catch (...) {
+                stop();
+                throw;
+            }
+        }
+
+        executor(const executor&) = delete;
+        executor& operator=(const executor&) = delete;
+
+        inline ~executor() {
+            wait_idle();
+            stop();
+        }
+
+        static inline std::size_t default_thread_count() {
+            return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        inline std::size_t thread_count() const {
+            return threads.size();
+        }
+
+    private:
+
+        //what submit stores - the copy_invocation of the wrapper, after clbl::bind_front when there are arguments
+        template<bool IsWrapper, typename Callable, typename... Args>
+        struct task_target_t
+            : task_target_t<true, decltype(bind_front(std::declval<Callable>(), std::declval<Args>()...))> {};
+
+        template<typename Callable>
+        struct task_target_t<true, Callable> {
+            using type = decltype(no_ref<Callable>::copy_invocation(std::declval<Callable>()));
+        };
+
+    public:
+
+        //whether submit(c, args...) stores the task in its slot, without a pool block
+        template<typename Callable, typename... Args>
+        static constexpr bool fits_task_slot = detail::task::fits_inline<
+            typename task_target_t<is_clbl<no_ref<Callable> > && sizeof...(Args) == 0, Callable, Args...>::type>;
+
+        template<typename Callable, std::enable_if_t<is_clbl<no_ref<Callable> >, dummy>* = nullptr>
+        inline void submit(Callable&& c) {
+            push(detail::task{ no_ref<Callable>::copy_invocation(std::forward<Callable>(c)) });
+        }
+
+        template<typename Callable, typename... Args, std::enable_if_t<
+            !is_clbl<no_ref<Callable> > || (sizeof...(Args) > 0), dummy>* = nullptr>
+        inline void submit(Callable&& c, Args&&... args) {
+            submit(bind_front(std::forward<Callable>(c), std::forward<Args>(args)...));
+        }
+
+        //blocks until every task submitted so far has finished
+        inline void wait_idle() {
+            std::unique_lock<std::mutex> lock{ idle_mutex };
+            idle.wait(lock, [this] { return unfinished.load() == 0; });
+        }
+
+    private:
+
+        struct current_worker {
+            const executor* owner = nullptr;
+            std::size_t index = 0;
+        };
+
+        static inline current_worker& this_thread_worker() {
+            static thread_local current_worker w;
+            return w;
+        }
+
+        /*
+        the counters go up before the task is visible to the workers, so a worker can't
+        finish it first - and back down if the deque can't grow to take it
+        */
+        inline void push(detail::task&& t) {
+            unfinished.fetch_add(1);
+            queued.fetch_add(1);
+
+            auto& self = this_thread_worker();
+            auto index = self.owner == this ? self.index : next.fetch_add(1, std::memory_order_relaxed) % workers.size();
+            try {
+                workers[index]->push_back(std::move(t));
+            }
+            catch (...) {
+                queued.fetch_sub(1);
+                finish_task();
+                throw;
+            }
+
+            if (sleepers.load() > 0) {
+                { std::lock_guard<std::mutex> lock{ sleep_mutex }; }
+                wake.notify_one();
+            }
+        }
+
+        inline bool find_task(std::size_t index, detail::task& t) {
+            if (workers[index]->pop_back(t))
+                return true;
+            for (std::size_t i = 1; i != workers.size(); ++i)
+                if (workers[(index + i) % workers.size()]->steal_front(t))
+                    return true;
+            return false;
+        }
+
+        inline void work(std::size_t index) {
+            this_thread_worker() = current_worker{ this, index };
+            detail::task t;
+
+            for (;;) {
+                if (find_task(index, t)) {
+                    queued.fetch_sub(1);
+                    t();
+                    finish_task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{ sleep_mutex };
+                sleepers.fetch_add(1);
+                wake.wait(lock, [this] { return queued.load() > 0 || stopping; });
+                sleepers.fetch_sub(1);
+                if (stopping && queued.load() == 0)
+                    return;
+            }
+        }
+
+        inline void finish_task() {
+            if (unfinished.fetch_sub(1) == 1) {
+                { std::lock_guard<std::mutex> lock{ idle_mutex }; }
+                idle.notify_all();
+            }
+        }
+
+        inline void stop() {
+            {
+                std::lock_guard<std::mutex> lock{ sleep_mutex };
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& t : threads)
+                t.join();
+        }
+
+        std::vector<std::unique_ptr<detail::task_deque> > workers;
+        std::vector<std::thread> threads;
+
+        std::atomic<std::size_t> queued;
+        std::atomic<std::size_t> unfinished;
+        std::atomic<std::size_t> sleepers;
+        std::atomic<std::size_t> next;
+
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        bool stopping;
+
+        std::mutex idle_mutex;
+        std::condition_variable idle;
+    };
+}
+
+#endif
\ No newline at end of file
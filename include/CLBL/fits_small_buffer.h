@@ -0,0 +1,76 @@
+#ifndef CLBL_FITS_SMALL_BUFFER_H
+#define CLBL_FITS_SMALL_BUFFER_H
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include <CLBL/tags.h>
+#include <CLBL/utility.h>
+#include <CLBL/convert_to.h>
+#include <CLBL/inline_function.h>
+
+namespace clbl {
+
+    /*
+    clbl::fits_small_buffer is true when clbl::convert_to can build a
+    TypeErasedFunctionTemplate from a Callable without allocating:
+
+        static_assert(clbl::fits_small_buffer<std::function, decltype(wrapper)&>, "");
+
+    Pass an lvalue reference type for lvalue conversions (the default, like
+    std::declval, is an rvalue conversion).
+
+    Whether a type-erased function stores a target inline is decided by
+    clbl::small_buffer_traits, which can be specialized for other types.
+    The std::function specialization mirrors libstdc++, libc++ and MSVC. For
+    other standard libraries it conservatively reports false.
+    */
+
+    template<typename TypeErasedFunction>
+    struct small_buffer_traits {
+        template<typename F>
+        static constexpr bool stores_inline() { return false; }
+    };
+
+    template<typename GlueType>
+    struct small_buffer_traits<std::function<GlueType> > {
+
+        template<typename F>
+        static constexpr bool stores_inline() {
+#if defined(__GLIBCXX__)
+            //libstdc++ stores location-invariant targets no larger than a PMF
+            return std::is_trivially_copyable<F>::value
+                && sizeof(F) <= sizeof(void(dummy::*)())
+                && alignof(void(dummy::*)()) % alignof(F) == 0;
+#elif defined(_LIBCPP_VERSION)
+            //libc++ has room for three pointers
+            return sizeof(F) <= 3 * sizeof(void*)
+                && alignof(F) <= alignof(typename std::aligned_storage<3 * sizeof(void*)>::type)
+                && std::is_nothrow_copy_constructible<F>::value;
+#elif defined(_MSC_VER)
+            //MSVC stores a vtable pointer next to the target in (6 + 16 / sizeof(void*) - 1) pointers
+            return sizeof(void*) + sizeof(F) <= (5 + 16 / sizeof(void*)) * sizeof(void*)
+                && alignof(F) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible<F>::value;
+#else
+            return false;
+#endif
+        }
+    };
+
+    template<typename GlueType, std::size_t Bytes>
+    struct small_buffer_traits<inline_function<GlueType, Bytes> > {
+        template<typename F>
+        static constexpr bool stores_inline() {
+            return sizeof(F) <= Bytes && alignof(F) <= alignof(std::max_align_t);
+        }
+    };
+
+    template<template<class> class TypeErasedFunctionTemplate, typename Callable>
+    constexpr bool fits_small_buffer = small_buffer_traits<
+        TypeErasedFunctionTemplate<forwarding_glue<Callable> >
+    >::template stores_inline<glue_type<Callable> >();
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,247 @@
+#ifndef CLBL_FOR_EACH_MEMBER_H
+#define CLBL_FOR_EACH_MEMBER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#include <CLBL/tags.h>
+#include <CLBL/utility.h>
+#include <CLBL/harden_cast.h>
+#include <CLBL/member_function_decay.h>
+#include <CLBL/invoke_batch.h>
+
+/*
+CLBL_PREFETCH_DISTANCE is how many elements ahead clbl::for_each_member prefetches
+the objects of a pointer range (0 turns prefetching off). CLBL_PARALLEL_GRAIN is
+the smallest number of objects worth giving a thread of its own in parallel mode.
+Define either one before including CLBL to change it.
+*/
+#ifndef CLBL_PREFETCH_DISTANCE
+#define CLBL_PREFETCH_DISTANCE 8
+#endif
+
+#ifndef CLBL_PARALLEL_GRAIN
+#define CLBL_PARALLEL_GRAIN 4096
+#endif
+
+static_assert(CLBL_PARALLEL_GRAIN > 0, "CLBL_PARALLEL_GRAIN must be at least 1.");
+
+namespace clbl {
+
+    /*
+    clbl::for_each_member calls the same member function on every object in a range:
+
+        clbl::for_each_member(&entity::update, entities, dt);           //std::vector<entity>
+        clbl::for_each_member(&entity::update, entity_ptrs, dt);        //std::vector<entity*>
+        clbl::for_each_member(clbl::parallel, &entity::update, entities, dt);
+        CLBL_FOR_EACH_MEMBER(&entity::update, entities, dt);            //PMF as a template argument
+
+    The range is anything clbl::invoke_batch accepts. Its elements are either
+    objects of the PMF's class (or a derived class), or pointers to them (raw
+    pointers, std::unique_ptr, std::shared_ptr...). The arguments are passed to every
+    call as lvalues, and results are discarded.
+
+    The PMF is held once for the whole range, instead of in a wrapper per object.
+    CLBL_FOR_EACH_MEMBER passes it as a template argument (like CLBL_PMFWRAP), so a
+    non-virtual member function can be inlined into the loop. For pointer ranges,
+    the object CLBL_PREFETCH_DISTANCE elements ahead is prefetched on each step, so
+    cold objects are already on their way to the cache when they are reached.
+
+    With clbl::parallel, the range is split into contiguous chunks of at least
+    CLBL_PARALLEL_GRAIN objects, one per hardware thread, and the calling thread
+    runs the first one. The member function must be safe to call concurrently on
+    different objects. The first exception thrown by any chunk is rethrown once
+    all of them are done.
+    */
+
+    namespace detail {
+
+        template<typename T>
+        struct member_class_t;
+
+        template<typename T, typename C>
+        struct member_class_t<T C::*> {
+            using type = C;
+        };
+
+        template<typename TMemberFnPtr>
+        using member_class = typename member_class_t<std::remove_cv_t<TMemberFnPtr> >::type;
+
+        inline void prefetch(const volatile void* p) {
+#if defined(__GNUC__)
+            __builtin_prefetch(const_cast<const void*>(p));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_prefetch(static_cast<const char*>(const_cast<const void*>(p)), _MM_HINT_T0);
+#else
+            (void)p;
+#endif
+        }
+
+        //the address held by a pointer-like element, without dereferencing it
+        template<typename T>
+        inline const volatile void* address_of_pointee(T* p, int) { return p; }
+
+        template<typename TPtr>
+        inline auto address_of_pointee(const TPtr& p, int) -> decltype(static_cast<const volatile void*>(p.get())) {
+            return p.get();
+        }
+
+        template<typename TPtr>
+        inline const volatile void* address_of_pointee(const TPtr&, long) { return nullptr; }
+
+        template<typename TMemberFnPtr, typename Element>
+        constexpr bool is_object_range = std::is_base_of<member_class<TMemberFnPtr>, std::remove_cv_t<Element> >::value;
+
+        //holds a PMF known at run time
+        template<typename TMemberFnPtr>
+        struct runtime_member {
+            TMemberFnPtr pmf;
+            inline TMemberFnPtr get() const { return pmf; }
+        };
+
+        //holds a PMF known at compile time
+        template<typename TMemberFnPtr, TMemberFnPtr Pmf>
+        struct static_member {
+            static inline constexpr TMemberFnPtr get() { return Pmf; }
+        };
+
+        template<typename TMemberFnPtr, typename Member, typename T, typename... Args>
+        inline void call_member(const Member& member, T& object, Args&... args) {
+            (harden_cast<member_object_flags<TMemberFnPtr> >(object).*member.get())(args...);
+        }
+
+        template<typename TMemberFnPtr, typename Member, typename Element, typename... Args,
+            std::enable_if_t<is_object_range<TMemberFnPtr, Element>, dummy>* = nullptr>
+        inline void for_each_member_in(const Member& member, Element* first, std::size_t n, Args&... args) {
+            for (std::size_t i = 0; i != n; ++i)
+                call_member<TMemberFnPtr>(member, first[i], args...);
+        }
+
+        template<typename TMemberFnPtr, typename Member, typename Element, typename... Args,
+            std::enable_if_t<!is_object_range<TMemberFnPtr, Element>, dummy>* = nullptr>
+        inline void for_each_member_in(const Member& member, Element* first, std::size_t n, Args&... args) {
+            constexpr std::size_t distance = CLBL_PREFETCH_DISTANCE;
+            std::size_t i = 0;
+            if (distance != 0) {
+                for (; i + distance < n; ++i) {
+                    prefetch(address_of_pointee(first[i + distance], 0));
+                    call_member<TMemberFnPtr>(member, *first[i], args...);
+                }
+            }
+            for (; i != n; ++i)
+                call_member<TMemberFnPtr>(member, *first[i], args...);
+        }
+
+        struct chunking {
+            std::size_t size;
+            std::size_t count;
+        };
+
+        /*
+        splits n objects into at most one chunk per worker, each of at least grain
+        objects where possible. Every chunk is non-empty, and only the last one may
+        be shorter than size.
+        */
+        inline chunking chunk_range(std::size_t n, std::size_t workers, std::size_t grain) {
+            if (n == 0) return chunking{ 0, 0 };
+            std::size_t wanted = std::max<std::size_t>(1, std::min<std::size_t>(workers, n / grain));
+            std::size_t size = (n + wanted - 1) / wanted;
+            return chunking{ size, (n + size - 1) / size };
+        }
+
+        template<typename TMemberFnPtr, typename Member, typename Element, typename... Args>
+        inline void parallel_for_each_member_in(const Member& member, Element* first, std::size_t n, Args&... args) {
+            std::size_t hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+            auto chunks = chunk_range(n, hardware, CLBL_PARALLEL_GRAIN);
+            if (chunks.count == 0) return;
+
+            std::vector<std::exception_ptr> errors(chunks.count);
+            std::vector<std::thread> threads;
+            threads.reserve(chunks.count - 1);
+
+            auto run_chunk = [&](std::size_t chunk) {
+                try {
+                    auto begin = chunk * chunks.size;
+                    for_each_member_in<TMemberFnPtr>(member, first + begin, std::min(chunks.size, n - begin), args...);
+                }
+                catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            //the started threads use run_chunk, so they are joined before a failed spawn is rethrown
+            try {
+                for (std::size_t chunk = 1; chunk < chunks.count; ++chunk)
+                    threads.emplace_back(run_chunk, chunk);
+            }
+            catch (...) {
+                for (auto& t : threads)
+                    t.join();
+                throw;
+            }
+
+            run_chunk(0);
+
+            for (auto& t : threads)
+                t.join();
+
+            for (auto& e : errors)
+                if (e) std::rethrow_exception(e);
+        }
+    }
+
+    template<typename TMemberFnPtr, typename Range, typename... Args, std::enable_if_t<
+        std::is_member_function_pointer<TMemberFnPtr>::value, dummy>* = nullptr>
+    inline void
+    for_each_member(TMemberFnPtr pmf, Range&& range, Args&&... args) {
+        detail::for_each_member_in<TMemberFnPtr>(detail::runtime_member<TMemberFnPtr>{ pmf },
+            detail::range_data(range), detail::range_size(range), args...);
+    }
+
+    template<typename TMemberFnPtr, typename Range, typename... Args, std::enable_if_t<
+        std::is_member_function_pointer<TMemberFnPtr>::value, dummy>* = nullptr>
+    inline void
+    for_each_member(parallel_t, TMemberFnPtr pmf, Range&& range, Args&&... args) {
+        detail::parallel_for_each_member_in<TMemberFnPtr>(detail::runtime_member<TMemberFnPtr>{ pmf },
+            detail::range_data(range), detail::range_size(range), args...);
+    }
+
+    /******************************************
+    PMF as a template argument
+    *******************************************/
+
+    template<typename TMemberFnPtr, TMemberFnPtr Pmf>
+    struct member_broadcast {
+
+        static_assert(std::is_member_function_pointer<TMemberFnPtr>::value, "Not a member function pointer.");
+
+        template<typename Range, typename... Args>
+        static inline void
+        for_each(Range&& range, Args&&... args) {
+            detail::for_each_member_in<TMemberFnPtr>(detail::static_member<TMemberFnPtr, Pmf>{},
+                detail::range_data(range), detail::range_size(range), args...);
+        }
+
+        template<typename Range, typename... Args>
+        static inline void
+        for_each(parallel_t, Range&& range, Args&&... args) {
+            detail::parallel_for_each_member_in<TMemberFnPtr>(detail::static_member<TMemberFnPtr, Pmf>{},
+                detail::range_data(range), detail::range_size(range), args...);
+        }
+    };
+
+#define CLBL_FOR_EACH_MEMBER(pmf_expr, ...) \
+(clbl::member_broadcast<clbl::no_ref<decltype(pmf_expr)>, pmf_expr>::for_each(__VA_ARGS__))
+}
+
+#endif
\ No newline at end of file
@@ -1,7 +1,9 @@
 #ifndef CLBL_FORWARD_H
 #define CLBL_FORWARD_H
 
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 #include <CLBL/forwardable.h>
 #include <CLBL/utility.h>
@@ -12,71 +14,133 @@ namespace clbl {
     clbl::forward is an implicitly convertible vessel for pefectly forwarded parameters. This allows
     us to create a "perfect forwarding" std::function object, that still forwards to the original
     function/object
+
+    A vessel only holds the address of the argument, so it never copies or moves it:
+
+         - forward<T&> converts back to T&
+         - forward<T&&> converts back to T&&, so move-only arguments are moved
+           straight from the caller into the original callable
+         - forward<T> (a by-value parameter) remembers whether it was constructed
+           from an rvalue, and moves from it if it was - the argument is copied
+           or moved exactly once, as if it were passed to the original callable
+
+    The conversions are noexcept, unless copying or moving a by-value argument can throw.
+    Vessels are usable in constant expressions (forward<T&&> since C++17, where
+    std::addressof is constexpr).
     */
 
     template<typename FwdType>
     struct forward {
 
-        std::conditional_t<std::is_rvalue_reference<FwdType>::value, 
-            const no_ref<FwdType>&, 
-            forwardable<FwdType> 
-        > value;
+        forwardable<FwdType> value;
 
-        inline forward() = default;
         inline forward(forward<FwdType>&) = default;
         inline forward(const forward<FwdType>&) = default;
         inline forward(forward<FwdType>&&) = default;
-        inline forward(volatile forward<FwdType>& other) : value(other.value) {}
-        inline forward(const volatile forward<FwdType>& other) : value(other.value) {}
+        inline constexpr forward(volatile forward<FwdType>& other) : value(other.value), is_rvalue(other.is_rvalue) {}
+        inline constexpr forward(const volatile forward<FwdType>& other) : value(other.value), is_rvalue(other.is_rvalue) {}
 
         //construction from rvalue
-        template<typename U = FwdType, std::enable_if_t<std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline forward(U t) : value(static_cast<U>(t)) {}
-
-        //construction from lvalue
-        template<typename U = FwdType, std::enable_if_t<std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline forward(const no_ref<U>& t) : value(t) {}
+        inline constexpr forward(FwdType&& t) noexcept : value(t), is_rvalue(true) {}
 
-        //construction from lvalue
-        template<typename U = FwdType, std::enable_if_t<!std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline forward(forwardable<FwdType> t) : value(t) {}
+        //construction from lvalue (only when the argument can be copied)
+        template<typename U = FwdType, std::enable_if_t<std::is_copy_constructible<U>::value, dummy>* = nullptr>
+        inline constexpr forward(const no_ref<U>& t) noexcept : value(t), is_rvalue(false) {}
 
-        //implicit conversion to xvalue
-        template<typename U = FwdType, std::enable_if_t<std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline operator U() const { 
-            return static_cast<U>(value);
+        //implicit conversion to prvalue
+        inline constexpr operator FwdType() const noexcept(is_nothrow_argument) {
+            return make_argument(value, is_rvalue);
         }
 
-        //implicit conversion to xvalue
-        template<typename U = FwdType, std::enable_if_t<std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline operator U() const volatile {
-            return static_cast<U>(value);
+        //implicit conversion to prvalue
+        inline constexpr operator FwdType() const volatile noexcept(is_nothrow_argument) {
+            return make_argument(value, is_rvalue);
         }
 
-        //implicit conversion to prvalue
-        template<typename U = FwdType, std::enable_if_t<std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline operator no_ref<U>() const {
-            return value;
+    private:
+
+        bool is_rvalue;
+
+        //the argument is moved or copied, so the conversion can throw if either can
+        static constexpr bool is_nothrow_argument = std::is_nothrow_move_constructible<FwdType>::value
+            && (!std::is_copy_constructible<FwdType>::value || std::is_nothrow_copy_constructible<FwdType>::value);
+
+        template<typename U = FwdType, std::enable_if_t<std::is_copy_constructible<U>::value, dummy>* = nullptr>
+        static inline constexpr U make_argument(const U& v, bool rvalue) {
+            return rvalue ? U(std::move(const_cast<U&>(v))) : U(v);
         }
 
-        //implicit conversion to prvalue
-        template<typename U = FwdType, std::enable_if_t<std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline operator no_ref<U>() const volatile {
-            return value;
+        template<typename U = FwdType, std::enable_if_t<!std::is_copy_constructible<U>::value, dummy>* = nullptr>
+        static inline constexpr U make_argument(const U& v, bool) {
+            return U(std::move(const_cast<U&>(v)));
         }
+    };
+
+    template<typename T>
+    struct forward<T&> {
+
+        T& value;
+
+        inline forward(forward<T&>&) = default;
+        inline forward(const forward<T&>&) = default;
+        inline forward(forward<T&>&&) = default;
+        inline constexpr forward(volatile forward<T&>& other) : value(other.value) {}
+        inline constexpr forward(const volatile forward<T&>& other) : value(other.value) {}
+
+        //construction from lvalue
+        inline constexpr forward(T& t) noexcept : value(t) {}
 
         //implicit conversion to lvalue reference
-        template<typename U = FwdType, std::enable_if_t<!std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline operator forwardable<FwdType>() const {
-            return value; 
+        inline constexpr operator T&() const noexcept {
+            return value;
         }
 
         //implicit conversion to lvalue reference
-        template<typename U = FwdType, std::enable_if_t<!std::is_rvalue_reference<U>::value, dummy>* = nullptr>
-        inline operator forwardable<FwdType>() const volatile {
+        inline constexpr operator T&() const volatile noexcept {
             return value;
         }
     };
+
+    template<typename T>
+    struct forward<T&&> {
+
+        T* value;
+
+        inline forward(forward<T&&>&) = default;
+        inline forward(const forward<T&&>&) = default;
+        inline forward(forward<T&&>&&) = default;
+        inline constexpr forward(volatile forward<T&&>& other) : value(other.value) {}
+        inline constexpr forward(const volatile forward<T&&>& other) : value(other.value) {}
+
+        //construction from rvalue
+        inline constexpr forward(T&& t) noexcept : value(std::addressof(t)) {}
+
+        //implicit conversion to xvalue
+        inline constexpr operator T&&() const noexcept {
+            return static_cast<T&&>(*value);
+        }
+
+        //implicit conversion to xvalue
+        inline constexpr operator T&&() const volatile noexcept {
+            return static_cast<T&&>(*value);
+        }
+    };
+
+    /*
+    clbl::glue_arg is the type of each parameter in a forwarding_glue function type. Trivially
+    copyable arguments of up to two words are passed by value, so they stay in registers across
+    the type-erased call - a vessel would only add a store and a reload. A type can be trivially
+    copyable with a deleted copy constructor, so that is checked too. Everything else is passed
+    through clbl::forward.
+    */
+    template<typename T>
+    constexpr bool passes_by_value = !std::is_reference<T>::value
+                                        && std::is_trivially_copyable<T>::value
+                                        && std::is_copy_constructible<T>::value
+                                        && sizeof(T) <= 2 * sizeof(void*);
+
+    template<typename T>
+    using glue_arg = std::conditional_t<passes_by_value<T>, T, forward<T> >;
 }
 
 #endif
\ No newline at end of file
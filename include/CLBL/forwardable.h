@@ -17,20 +17,11 @@ namespace clbl {
     template<typename T>
     using forwardable = typename detail::forwardable_t<T>::type;
 
-    /* RVO makes this unnecessary...
-    namespace detail {
-        template<typename T>
-        struct return_forwardable_t { using type = T&&; };
-
-        template<typename T>
-        struct return_forwardable_t<T&> { using type = T&; };
-
-        template<>
-        struct return_forwardable_t<void> { using type = void; };
-    }
-
-    template<typename T>
-    using return_forwardable = typename detail::return_forwardable_t<T>::type;
+    /*
+    Return values don't need a vessel. Every layer between the original callable and a
+    type-erased function returns exactly the original Return type: the wrappers' operator(),
+    the copy_invocation lambdas (which return decltype(auto)), and the glue. So T& and T&&
+    returns stay references, and by-value returns are constructed in place (RVO).
     */
 
 }
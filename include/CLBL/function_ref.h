@@ -0,0 +1,67 @@
+#ifndef CLBL_FUNCTION_REF_H
+#define CLBL_FUNCTION_REF_H
+
+#include <type_traits>
+#include <memory>
+
+#include <CLBL/tags.h>
+#include <CLBL/erased_call.h>
+#include <CLBL/utility.h>
+
+namespace clbl {
+
+    /*
+    clbl::function_ref is a non-owning, type-erased view of a CLBL wrapper. It
+    holds only the address of the wrapper and a pointer to a call thunk, so
+    creating, copying and passing one never allocates, and never copies the
+    wrapper. clbl::make_function_ref deduces the glue signature the same way
+    clbl::convert_to does. Since the thunk calls the wrapper through a pointer
+    to the wrapper's own (possibly cv-qualified) type, the CV overload selected
+    by the wrapper is preserved. The viewed wrapper must outlive the view.
+    */
+
+    template<typename BadGlueType>
+    struct function_ref {
+        static_assert(sizeof(BadGlueType) < 0, "Invalid template arguments.");
+    };
+
+    template<typename Return, typename... GlueArgs>
+    struct function_ref<Return(GlueArgs...)> {
+
+        using my_type = function_ref<Return(GlueArgs...)>;
+        using call_type = erased_call<Return, GlueArgs...>;
+        using thunk_type = typename call_type::thunk_type;
+
+        const volatile void* object;
+        thunk_type thunk;
+
+        template<typename Callable, std::enable_if_t<
+            is_clbl<std::remove_cv_t<Callable> >, dummy>* = nullptr>
+        inline function_ref(Callable& c)
+            : object{ std::addressof(c) }, thunk{ call_type::template thunk_for<Callable>() }
+        {}
+
+        inline function_ref(const my_type&) = default;
+        inline my_type& operator=(const my_type&) = default;
+
+        inline Return operator()(GlueArgs... args) const {
+            return call_type::call(thunk, const_cast<void*>(object), args...);
+        }
+    };
+
+    template<typename Callable>
+    inline auto make_function_ref(Callable& c) {
+
+        static_assert(!std::is_same<typename no_ref<Callable>::return_type, ambiguous_return>::value,
+            "Ambiguous signature. Please disambiguate by calling clbl::harden before calling clbl::make_function_ref.");
+
+        return function_ref<forwarding_glue<Callable> >{ c };
+    }
+
+    //temporaries are rejected, because the view would dangle as soon as the full expression ends
+    template<typename Callable, std::enable_if_t<
+        !std::is_lvalue_reference<Callable>::value, dummy>* = nullptr>
+    void make_function_ref(Callable&& c) = delete;
+}
+
+#endif
\ No newline at end of file
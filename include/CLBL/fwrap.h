@@ -5,11 +5,13 @@
 #include <functional>
 
 #include <CLBL/wrappers/free_fn_wrapper.h>
+#include <CLBL/wrappers/free_fn_wrapper_slim.h>
 #include <CLBL/wrappers/pmf_wrapper.h>
 #include <CLBL/wrappers/pmf_ptr_wrapper.h>
 #include <CLBL/wrappers/ambi_fn_obj_wrapper.h>
 #include <CLBL/wrappers/ambi_fn_obj_ptr_wrapper.h>
 #include <CLBL/wrap/free_function.h>
+#include <CLBL/wrap/free_function_slim.h>
 #include <CLBL/wrap/function_object.h>
 #include <CLBL/wrap/pointer_to_function_object.h>
 #include <CLBL/wrap/member_function_with_object.h>
@@ -18,6 +20,7 @@
 #include <CLBL/wrap/member_function_with_pointer_to_object_slim.h>
 #include <CLBL/member_function_decay.h>
 #include <CLBL/tags.h>
+#include <CLBL/ownership.h>
 #include <CLBL/qualify_flags.h>
 #include <CLBL/utility.h>
 #include <CLBL/is_valid.h>
@@ -31,11 +34,11 @@ namespace clbl {
 
     namespace detail {
 
-        auto has_normal_call_operator_impl = is_valid(
+        static auto has_normal_call_operator_impl = is_valid(
             [](auto&& arg)->decltype(&no_ref<decltype(arg)>::operator()) {}
         );
 
-        auto ptr_has_normal_call_operator_impl = is_valid(
+        static auto ptr_has_normal_call_operator_impl = is_valid(
             [](auto&& arg)->decltype(&no_ref<decltype(*arg)>::operator()) {}
         );
 
@@ -121,6 +124,34 @@ namespace clbl {
             wrap<qflags::default_>(member_fn_ptr, std::forward<T>(t));
     }
 
+    /*************************************************************************
+    Pointer to object with a member function pointer, devirtualized on creation
+    **************************************************************************/
+
+    /*
+    The object's dynamic type must not change for the lifetime of the wrapper,
+    and a pointer bound to a virtual member function must point to a live object
+    when the wrapper is created, since its vtable is read then. Calls go straight
+    to the final overrider, without a vtable lookup.
+    */
+
+    template<typename T, typename TMemberFnPtr, std::enable_if_t<
+        detail::sfinae_switch<TMemberFnPtr>::member_function_ptr_case 
+        && detail::sfinae_switch<T>::is_ptr, dummy>* = nullptr>
+    inline constexpr auto 
+    fwrap(devirtualize_t, T&& t, TMemberFnPtr member_fn_ptr) {
+        return member_function_with_pointer_to_object::devirtualized::template
+            wrap<qflags::default_>(member_fn_ptr, std::forward<T>(t));
+    }
+
+    template<typename T, typename TMemberFnPtr, std::enable_if_t<
+        detail::sfinae_switch<TMemberFnPtr>::member_function_ptr_case
+        && detail::sfinae_switch<T>::reference_wrapper_case, dummy>* = nullptr>
+    inline constexpr auto 
+    fwrap(devirtualize_t d, T&& t, TMemberFnPtr ptr) {
+        return fwrap(d, std::addressof(t.get()), ptr);
+    }
+
     /**********************************
     Object with member function pointer
     ***********************************/
@@ -215,7 +246,7 @@ namespace clbl {
     {
         template<typename T, std::enable_if_t<
             !detail::sfinae_switch<T>::is_ptr
-            && !detail::sfinae_switch<T>::is_ref_wrapper, dummy>* = nullptr>
+            && !detail::sfinae_switch<T>::reference_wrapper_case, dummy>* = nullptr>
         static constexpr auto 
         fwrap(T&& t) {
             return member_function_with_object_slim::template
@@ -224,7 +255,7 @@ namespace clbl {
 
         template<typename TPtr, std::enable_if_t<
             detail::sfinae_switch<TPtr>::is_ptr
-            && !detail::sfinae_switch<TPtr>::is_ref_wrapper, dummy>* = nullptr>
+            && !detail::sfinae_switch<TPtr>::reference_wrapper_case, dummy>* = nullptr>
         static constexpr auto
         fwrap(TPtr&& object_ptr) {
             return member_function_with_pointer_to_object_slim::template
@@ -233,17 +264,64 @@ namespace clbl {
 
         template<typename T, std::enable_if_t<
             detail::sfinae_switch<T>::reference_wrapper_case, dummy>* = nullptr>
-        inline constexpr auto
+        static constexpr auto
         fwrap(T&& t) {
             return fwrap(std::addressof(t.get()));
         }
+
+        //pointer to object with an ownership policy (see CLBL/ownership.h)
+        template<typename Policy, typename TPtr, std::enable_if_t<
+            is_ownership_policy<Policy>, dummy>* = nullptr>
+        static inline constexpr auto
+        fwrap(Policy policy, TPtr&& object_ptr) {
+            return fwrap(detail::take_ownership(policy, std::forward<TPtr>(object_ptr)));
+        }
+    };
+
+//CLBL_PMFWRAP(pmf_expr, o) or CLBL_PMFWRAP(pmf_expr, policy, object_ptr)
+#define CLBL_PMFWRAP(pmf_expr, ...) \
+(clbl::pmf<clbl::no_ref<decltype(pmf_expr)>, pmf_expr>::fwrap(__VA_ARGS__))
+
+    /******************************************
+    Free function pointer as a template argument
+    *******************************************/
+
+    template <typename TFnPtr, TFnPtr FnPtr>
+    struct fn
+    {
+        static_assert(std::is_function<std::remove_pointer_t<TFnPtr> >::value, "Not a function pointer.");
+
+        static constexpr auto
+        fwrap() {
+            return free_function_slim::template
+                wrap<qflags::default_, TFnPtr, FnPtr>();
+        }
     };
 
-#define CLBL_PMFWRAP(pmf_expr, o) \
-(clbl::pmf<clbl::no_ref<decltype(pmf_expr)>, pmf_expr>::fwrap(o))
+#define CLBL_FNWRAP(fn_expr) \
+(clbl::fn<std::decay_t<decltype(fn_expr)>, fn_expr>::fwrap())
 
     //todo size tests, reference_wrapper tests, CLBL_PMFWRAP tests
 
+    /**************************************************************
+    Pointer to object with an ownership policy (see CLBL/ownership.h)
+    ***************************************************************/
+
+    template<typename Policy, typename TPtr, typename TMemberFnPtr, std::enable_if_t<
+        is_ownership_policy<Policy>
+        && detail::sfinae_switch<TMemberFnPtr>::member_function_ptr_case, dummy>* = nullptr>
+    inline constexpr auto
+    fwrap(Policy policy, TPtr&& object_ptr, TMemberFnPtr member_fn_ptr) {
+        return fwrap(detail::take_ownership(policy, std::forward<TPtr>(object_ptr)), member_fn_ptr);
+    }
+
+    template<typename Policy, typename TPtr, std::enable_if_t<
+        is_ownership_policy<Policy>, dummy>* = nullptr>
+    inline constexpr auto
+    fwrap(Policy policy, TPtr&& object_ptr) {
+        return fwrap(detail::take_ownership(policy, std::forward<TPtr>(object_ptr)));
+    }
+
     /*********************************************
     preempting recursive attempts at CLBL wrappers
     **********************************************/
@@ -255,7 +333,7 @@ namespace clbl {
     fwrap(T&& t) {
         using callable = no_ref<T>;
         return callable::creator::template
-            wrap_data<callable::cv_flags | cv<callable> >(t.data);
+            wrap_data<callable::cv_flags | cv<callable> >(std::forward<T>(t).data);
     }
 
     template<typename T, std::enable_if_t<
@@ -267,6 +345,25 @@ namespace clbl {
         return callable::creator::template
             wrap_data<callable::cv_flags | cv<callable> >(t -> data);
     }
+
+    namespace detail {
+
+        /*
+        fwrap_unless_clbl passes CLBL wrappers through as they are, for functions
+        that store a wrapper (clbl::bind_front, clbl::compose)
+        */
+        template<typename Callable, std::enable_if_t<
+            is_clbl<no_ref<Callable> >, dummy>* = nullptr>
+        inline constexpr Callable&& fwrap_unless_clbl(Callable&& c) {
+            return std::forward<Callable>(c);
+        }
+
+        template<typename Callable, std::enable_if_t<
+            !is_clbl<no_ref<Callable> >, dummy>* = nullptr>
+        inline constexpr auto fwrap_unless_clbl(Callable&& c) {
+            return fwrap(std::forward<Callable>(c));
+        }
+    }
 }
 
 #endif
\ No newline at end of file
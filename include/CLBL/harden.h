@@ -1,7 +1,11 @@
 #ifndef CLBL_HARDEN_H
 #define CLBL_HARDEN_H
 
+#include <cstddef>
 #include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include <CLBL/tags.h>
 #include <CLBL/qualify_flags.h>
@@ -9,11 +13,17 @@
 #include <CLBL/fwrap.h>
 #include <CLBL/utility.h>
 #include <CLBL/harden_cast.h>
+#include <CLBL/invocation_data.h>
+#include <CLBL/member_function_decay.h>
+#include <CLBL/wrap/bound_function.h>
+#include <CLBL/wrap/composed_function.h>
+#include <CLBL/wrap/decorated_function.h>
 
 namespace clbl {
 
     /*
     clbl::harden is used to disambiguate overloads of operator() in a CLBL wrapper.
+    The invocation data of an rvalue wrapper is moved, not copied.
     */
 
     namespace detail {
@@ -44,7 +54,7 @@ namespace clbl {
             static inline constexpr auto
             wrap_data(Invocation&& data) {
                 return pointer_to_function_object::casted::template 
-                    wrap<Flags, TMemberFnPtr>(data.ptr);
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data).ptr);
             }
         };
 
@@ -54,7 +64,7 @@ namespace clbl {
             static inline constexpr auto
                 wrap_data(Invocation&& data) {
                 return pointer_to_function_object::casted::template 
-                    wrap<Flags, TMemberFnPtr>(data.object_ptr);
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data).object_ptr);
             }
         };
 
@@ -64,7 +74,7 @@ namespace clbl {
             static inline constexpr auto
                 wrap_data(Invocation&& data) {
                 return function_object::casted::template 
-                    wrap<Flags, TMemberFnPtr>(data.object);
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data).object);
             }
         };
 
@@ -74,51 +84,199 @@ namespace clbl {
             static inline constexpr auto
                 wrap_data(Invocation&& data) {
                 return function_object::casted::template 
-                    wrap<Flags, TMemberFnPtr>(data.object);
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data).object);
             }
         };
 
+        template<typename Bad>
+        struct harden_t;
+
+        /*
+        front_signature_t<TMemberFnPtr, std::tuple<Front...> >::type is auto_(Front..., Args...) cv
+        for a requested Return(C::*)(Args...) cv ref - the signature a wrapper held by a
+        bound_fn_wrapper, composed_fn_wrapper or decorated_fn_wrapper is hardened with
+        */
+        template<typename TMemberFnPtr, typename FrontTuple>
+        struct front_signature_t;
+
+#define __CLBL_SPECIALIZE_FRONT_SIGNATURE(cv_requested, ref_requested) \
+        template<typename T, typename Return, typename... Args, typename... Front> \
+        struct front_signature_t<Return(T::*)(Args...) cv_requested ref_requested, std::tuple<Front...> > { \
+            using type = auto_(Front..., Args...) cv_requested; \
+        }
+
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(__CLBL_NO_CV, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(const, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(volatile, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(const volatile, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(__CLBL_NO_CV, &);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(const, &);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(volatile, &);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(const volatile, &);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(__CLBL_NO_CV, &&);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(const, &&);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(volatile, &&);
+        __CLBL_SPECIALIZE_FRONT_SIGNATURE(const volatile, &&);
+
+        template<typename Data>
+        struct bound_arg_types;
+
+        template<typename Callable, typename... BoundArgs>
+        struct bound_arg_types<bound_invocation_data<Callable, BoundArgs...> > {
+            using type = std::tuple<BoundArgs...>;
+        };
+
+        /*
+        A bound_fn_wrapper, composed_fn_wrapper or decorated_fn_wrapper passes its
+        arguments through to the wrapper in element 0 of its invocation data (the
+        bound callable, the first stage, or the decorated callable), so hardening
+        it hardens that wrapper, which pins the overload. The types of the bound
+        arguments (Front) are prepended to the requested parameters, and the held
+        wrapper deduces its own return type. The requested CV qualifiers are applied
+        as usual, but the value category still comes from the call (the requested
+        ref-qualifier is ignored). The rest of the invocation data - bound arguments,
+        later stages or advice objects - is copied or moved into the new wrapper.
+        */
+        template<template<typename> class Creator, typename Front, std::size_t RestCount>
+        struct disambiguate_front {
+
+            template<qualify_flags Flags, typename TMemberFnPtr, typename Invocation, std::size_t... I>
+            static inline constexpr auto
+                rewrap(Invocation&& data, std::index_sequence<I...>) {
+                using requested_fn = typename member_function_decay_t<TMemberFnPtr>::function_type;
+                using front_fn = typename front_signature_t<TMemberFnPtr, Front>::type;
+                return Creator<requested_fn>::template wrap<Flags>(
+                    harden_t<front_fn>{}(bound_get<0>(std::forward<Invocation>(data))),
+                    bound_get<I + 1>(std::forward<Invocation>(data))...);
+            }
+
+            template<qualify_flags Flags, typename TMemberFnPtr, typename Invocation>
+            static inline constexpr auto
+                wrap(Invocation&& data) {
+                return rewrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data),
+                    std::make_index_sequence<RestCount>{});
+            }
+        };
+
+        template<typename TMemberFnPtr, typename C, typename FunctionType>
+        struct disambiguate<TMemberFnPtr, C, bound_function<FunctionType> > {
+            template<qualify_flags Flags, typename Invocation>
+            static inline constexpr auto
+                wrap_data(Invocation&& data) {
+                using data_type = std::remove_cv_t<no_ref<Invocation> >;
+                using front = typename bound_arg_types<data_type>::type;
+                return disambiguate_front<bound_function, front, std::tuple_size<front>::value>::template
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data));
+            }
+        };
+
+        template<typename TMemberFnPtr, typename C, typename FunctionType>
+        struct disambiguate<TMemberFnPtr, C, composed_function<FunctionType> > {
+            template<qualify_flags Flags, typename Invocation>
+            static inline constexpr auto
+                wrap_data(Invocation&& data) {
+                using data_type = std::remove_cv_t<no_ref<Invocation> >;
+                return disambiguate_front<composed_function, std::tuple<>, data_type::stage_count - 1>::template
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data));
+            }
+        };
+
+        template<typename TMemberFnPtr, typename C, typename FunctionType>
+        struct disambiguate<TMemberFnPtr, C, decorated_function<FunctionType> > {
+            template<qualify_flags Flags, typename Invocation>
+            static inline constexpr auto
+                wrap_data(Invocation&& data) {
+                using data_type = std::remove_cv_t<no_ref<Invocation> >;
+                return disambiguate_front<decorated_function, std::tuple<>, data_type::advice_count>::template
+                    wrap<Flags, TMemberFnPtr>(std::forward<Invocation>(data));
+            }
+        };
+
+        /*
+        hardened_return is the return type of a hardened wrapper. It is Return, unless
+        Return is clbl::auto_ - only then is the call formed, so wrappers that can't be
+        called with the requested qualifiers are never looked at. If the wrapper itself
+        can't be called that way (a casted wrapper whose operator() was already
+        disambiguated), the return type comes from its underlying object
+        */
+        template<qualify_flags Flags, typename Callable, typename... Args>
+        inline auto deduce_hardened_return(int)
+            -> decltype(harden_cast<Flags>(std::declval<Callable&>())(std::declval<Args>()...));
+
+        template<qualify_flags Flags, typename Callable, typename... Args>
+        inline auto deduce_hardened_return(long)
+            -> decltype(harden_cast<Flags>(std::declval<typename Callable::underlying_type&>())(std::declval<Args>()...));
+
+        template<typename Return, qualify_flags Flags, typename Callable, typename... Args>
+        struct hardened_return {
+            using type = Return;
+        };
+
+        template<qualify_flags Flags, typename Callable, typename... Args>
+        struct hardened_return<auto_, Flags, Callable, Args...> {
+            using type = decltype(deduce_hardened_return<Flags, Callable, Args...>(0));
+        };
+
         template<typename Bad>
         struct harden_t {
             static_assert(sizeof(Bad) < 0, "Not a valid function type.");
         };
 
         /*
-        Chainsawing the Gordian knot by spamming CV permutations with the preprocessor
+        Chainsawing the Gordian knot by spamming CV permutations with the preprocessor.
+        The && overloads move the invocation data of an rvalue wrapper into the
+        hardened wrapper, instead of copying it. A requested ref-qualifier selects
+        the matching overload of the object's operator() - like any other wrapper,
+        the hardened wrapper can only call a &&-qualified overload as an rvalue
         */
 
-#define __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, cv_present) \
-        template<typename Callable> \
+#define __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, cv_present, ref) \
+        template<typename Callable, std::enable_if_t< \
+            !std::is_reference<Callable>::value, dummy>* = nullptr> \
         inline constexpr auto \
-        operator()(cv_present Callable& c) const { \
+        operator()(cv_present Callable ref c) const { \
             constexpr qualify_flags requested = cv<cv_requested dummy>; \
+            constexpr qualify_flags requested_ref = member_ref_flags<void(dummy::*)() ref_requested>; \
             constexpr qualify_flags present = cv<cv_present dummy>; \
             using C = no_ref<Callable>; \
             using underlying_type = typename C::underlying_type; \
-            using return_type = std::conditional_t<std::is_same<Return, auto_>::value, \
-                                decltype(harden_cast<(requested | present)>(c)(std::declval<Args>()...)), \
-                                Return>; \
-            using abominable_fn_type = return_type(Args...) cv_requested; \
-            using requested_pmf_type = abominable_fn_type underlying_type::*; \
+            using return_type = typename hardened_return<Return, \
+                                (requested | present | requested_ref), cv_present C, Args...>::type; \
+            using requested_pmf_type = return_type(underlying_type::*)(Args...) cv_requested ref_requested; \
             using disambiguator = disambiguate<requested_pmf_type, C, typename C::creator>; \
-            return disambiguator::template wrap_data<requested | present>(c.data); \
+            return disambiguator::template wrap_data<requested | present>( \
+                static_cast<cv_present Callable ref>(c).data); \
         }
-            
-#define __CLBL_SPECIALIZE_HARDEN_T(cv_requested) \
+
+#define __CLBL_SPECIALIZE_HARDEN_T(cv_requested, ref_requested) \
         template<typename Return, typename... Args> \
-            struct harden_t<Return(Args...) cv_requested> { \
-            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, __CLBL_NO_CV) \
-            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, const) \
-            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, volatile) \
-            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, const volatile) \
+            struct harden_t<Return(Args...) cv_requested ref_requested> { \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, __CLBL_NO_CV, &) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, const, &) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, volatile, &) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, const volatile, &) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, __CLBL_NO_CV, &&) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, const, &&) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, volatile, &&) \
+            __CLBL_DEFINE_HARDEN_T_OVERLOADS(cv_requested, ref_requested, const volatile, &&) \
         }
 
-        //ellipses and ref qualifiers not yet implemented...
+        //ellipses not yet implemented...
+
+        __CLBL_SPECIALIZE_HARDEN_T(__CLBL_NO_CV, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_HARDEN_T(const, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_HARDEN_T(volatile, __CLBL_NO_CV);
+        __CLBL_SPECIALIZE_HARDEN_T(const volatile, __CLBL_NO_CV);
+
+        __CLBL_SPECIALIZE_HARDEN_T(__CLBL_NO_CV, &);
+        __CLBL_SPECIALIZE_HARDEN_T(const, &);
+        __CLBL_SPECIALIZE_HARDEN_T(volatile, &);
+        __CLBL_SPECIALIZE_HARDEN_T(const volatile, &);
 
-        __CLBL_SPECIALIZE_HARDEN_T(__CLBL_NO_CV);
-        __CLBL_SPECIALIZE_HARDEN_T(const);
-        __CLBL_SPECIALIZE_HARDEN_T(volatile);
-        __CLBL_SPECIALIZE_HARDEN_T(const volatile);
+        __CLBL_SPECIALIZE_HARDEN_T(__CLBL_NO_CV, &&);
+        __CLBL_SPECIALIZE_HARDEN_T(const, &&);
+        __CLBL_SPECIALIZE_HARDEN_T(volatile, &&);
+        __CLBL_SPECIALIZE_HARDEN_T(const volatile, &&);
 
         template<typename T>
         constexpr harden_t<T> harden_v{};
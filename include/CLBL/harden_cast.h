@@ -1,6 +1,9 @@
 #ifndef CLBL_HARDEN_CAST_H
 #define CLBL_HARDEN_CAST_H
 
+#include <type_traits>
+#include <utility>
+
 #include <CLBL/apply_qualifiers.h>
 #include <CLBL/cv.h>
 #include <CLBL/qualify_flags.h>
@@ -8,14 +11,55 @@
 namespace clbl {
 
     /*
-    clbl::harden_cast is used internally to force desired qualify_flags on a reference
+    clbl::harden_cast is used internally to force desired qualify_flags on a reference.
+    The value category of the argument is kept, unless one of the reference flags is
+    requested (which is how ref-qualified PMFs get the object they need)
     */
 
+    namespace detail {
+
+        template<qualify_flags CvFlags, typename Object>
+        constexpr qualify_flags harden_cast_reference =
+            (CvFlags & qflags::rvalue_reference_) ? qflags::rvalue_reference_
+            : (CvFlags & qflags::lvalue_reference_) ? qflags::lvalue_reference_
+            : std::is_lvalue_reference<Object>::value ? qflags::lvalue_reference_
+            : qflags::rvalue_reference_;
+    }
+
     template<qualify_flags CvFlags, typename Object>
     inline constexpr auto 
-        harden_cast(Object&& o) 
-            -> apply_qualifiers<Object, CvFlags | cv<Object> | qflags::lvalue_reference_> {
-        return std::forward<Object>(o);
+        harden_cast(Object&& o) noexcept
+            -> apply_qualifiers<Object, ((CvFlags | cv<Object>) & qflags::cv_)
+                | detail::harden_cast_reference<CvFlags, Object> > {
+        return static_cast<apply_qualifiers<Object, ((CvFlags | cv<Object>) & qflags::cv_)
+                | detail::harden_cast_reference<CvFlags, Object> > >(o);
+    }
+
+    namespace detail {
+
+        /*
+        invoke_member and invoke_member_ptr make the member calls of the
+        CLBL_UPCAST_AND_CALL_MEMBER_* macros. Inside a function template, a call
+        that is invalid for the object's cv-qualifiers or value category (e.g. a
+        &&-qualified PMF on an lvalue) is a substitution failure - written out in
+        a wrapper's operator(), it would be an error as soon as the wrapper's class
+        is instantiated, because none of its operands depend on the call's arguments
+        */
+        template<qualify_flags Flags, typename Object, typename TMemberFnPtr, typename... Fargs>
+        inline constexpr auto
+            invoke_member(Object&& o, TMemberFnPtr pmf, Fargs&&... a)
+                noexcept(noexcept((harden_cast<Flags>(std::forward<Object>(o)).*pmf)(std::forward<Fargs>(a)...)))
+                -> decltype((harden_cast<Flags>(std::forward<Object>(o)).*pmf)(std::forward<Fargs>(a)...)) {
+            return (harden_cast<Flags>(std::forward<Object>(o)).*pmf)(std::forward<Fargs>(a)...);
+        }
+
+        template<qualify_flags Flags, typename TPtr, typename TMemberFnPtr, typename... Fargs>
+        inline constexpr auto
+            invoke_member_ptr(TPtr& p, TMemberFnPtr pmf, Fargs&&... a)
+                noexcept(noexcept((harden_cast<Flags>(*p).*pmf)(std::forward<Fargs>(a)...)))
+                -> decltype((harden_cast<Flags>(*p).*pmf)(std::forward<Fargs>(a)...)) {
+            return (harden_cast<Flags>(*p).*pmf)(std::forward<Fargs>(a)...);
+        }
     }
 }
 
@@ -0,0 +1,193 @@
+#ifndef CLBL_INLINE_FUNCTION_H
+#define CLBL_INLINE_FUNCTION_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/erased_call.h>
+#include <CLBL/utility.h>
+
+namespace clbl {
+
+    /*
+    clbl::inline_function is an owning, type-erased callable that stores its
+    target in a buffer of Bytes bytes inside the object itself. It never touches
+    the heap - storing a target that does not fit is a compile-time error, so
+    a clbl::convert_to conversion either stays inline or fails to build.
+
+    clbl::convert_to expects a template with a single parameter, so the capacity
+    is chosen through clbl::inline_capacity:
+
+        auto f = clbl::convert_to<clbl::inline_capacity<32>::function>(wrapper);
+
+    Like std::function, a default-constructed inline_function is empty, and
+    calling an empty inline_function is undefined. Targets must be nothrow move
+    constructible, so moving an inline_function never throws, and containers
+    move it instead of copying it when they grow. If copying a target throws,
+    the inline_function copied or assigned to is left empty.
+    */
+
+    constexpr std::size_t default_inline_capacity = 4 * sizeof(void*);
+
+    template<typename BadGlueType, std::size_t Bytes = default_inline_capacity>
+    struct inline_function {
+        static_assert(sizeof(BadGlueType) < 0, "Invalid template arguments.");
+    };
+
+    template<typename Return, std::size_t Bytes, typename... GlueArgs>
+    struct inline_function<Return(GlueArgs...), Bytes> {
+
+        static_assert(Bytes > 0, "clbl::inline_function needs a capacity of at least one byte.");
+
+        using my_type = inline_function<Return(GlueArgs...), Bytes>;
+        using call_type = erased_call<Return, GlueArgs...>;
+
+        static constexpr std::size_t capacity = Bytes;
+
+        inline inline_function()
+            : ops{ nullptr }
+        {}
+
+        template<typename F, std::enable_if_t<
+            !std::is_same<std::decay_t<F>, my_type>::value, dummy>* = nullptr>
+        inline inline_function(F&& f)
+            : ops{ &operations_for<std::decay_t<F> >() } {
+
+            using target = std::decay_t<F>;
+
+            static_assert(sizeof(target) <= Bytes,
+                "The callable does not fit in this clbl::inline_function. Increase the capacity.");
+
+            static_assert(alignof(target) <= alignof(std::max_align_t),
+                "Over-aligned callables cannot be stored in a clbl::inline_function.");
+
+            static_assert(std::is_nothrow_move_constructible<target>::value,
+                "Callables stored in a clbl::inline_function must be nothrow move constructible.");
+
+            ::new (static_cast<void*>(storage)) target(std::forward<F>(f));
+        }
+
+        inline inline_function(const my_type& other)
+            : ops{ nullptr } {
+            copy_from(other);
+        }
+
+        inline inline_function(my_type&& other) noexcept
+            : ops{ nullptr } {
+            move_from(other);
+        }
+
+        inline my_type& operator=(const my_type& other) {
+            if (this != &other) {
+                reset();
+                copy_from(other);
+            }
+            return *this;
+        }
+
+        inline my_type& operator=(my_type&& other) noexcept {
+            if (this != &other) {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        inline ~inline_function() {
+            reset();
+        }
+
+        inline Return operator()(GlueArgs... args) const {
+            return call_type::call(ops->invoke, storage, args...);
+        }
+
+        inline explicit operator bool() const {
+            return ops != nullptr;
+        }
+
+    private:
+
+        /*
+        copy, move and destroy are left null for trivially relocatable targets,
+        which are copied and moved with memcpy instead
+        */
+        struct operations {
+            typename call_type::thunk_type invoke;
+            void(*copy)(void*, const void*);
+            void(*move)(void*, void*);
+            void(*destroy)(void*);
+        };
+
+        template<typename F>
+        struct target_operations {
+
+            static inline void copy(void* to, const void* from) {
+                ::new (to) F(*static_cast<const F*>(from));
+            }
+
+            static inline void move(void* to, void* from) noexcept {
+                ::new (to) F(std::move(*static_cast<F*>(from)));
+            }
+
+            static inline void destroy(void* s) {
+                static_cast<F*>(s)->~F();
+            }
+        };
+
+        template<typename F, std::enable_if_t<
+            is_trivially_relocatable<F>, dummy>* = nullptr>
+        static inline const operations& operations_for() {
+            static const operations ops = { call_type::template thunk_for<F>(), nullptr, nullptr, nullptr };
+            return ops;
+        }
+
+        template<typename F, std::enable_if_t<
+            !is_trivially_relocatable<F>, dummy>* = nullptr>
+        static inline const operations& operations_for() {
+            static const operations ops = {
+                call_type::template thunk_for<F>(),
+                &target_operations<F>::copy,
+                &target_operations<F>::move,
+                &target_operations<F>::destroy
+            };
+            return ops;
+        }
+
+        //ops is only set once the target has been constructed in storage
+        inline void copy_from(const my_type& other) {
+            if (other.ops == nullptr) return;
+            if (other.ops->copy == nullptr) std::memcpy(storage, other.storage, Bytes);
+            else other.ops->copy(storage, other.storage);
+            ops = other.ops;
+        }
+
+        inline void move_from(my_type& other) noexcept {
+            if (other.ops == nullptr) return;
+            if (other.ops->move == nullptr) std::memcpy(storage, other.storage, Bytes);
+            else other.ops->move(storage, other.storage);
+            ops = other.ops;
+        }
+
+        inline void reset() {
+            if (ops != nullptr && ops->destroy != nullptr) {
+                ops->destroy(storage);
+            }
+            ops = nullptr;
+        }
+
+        const operations* ops;
+        alignas(std::max_align_t) mutable unsigned char storage[Bytes];
+    };
+
+    template<std::size_t Bytes>
+    struct inline_capacity {
+        template<typename GlueType>
+        using function = inline_function<GlueType, Bytes>;
+    };
+}
+
+#endif
\ No newline at end of file
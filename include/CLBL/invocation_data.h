@@ -1,7 +1,16 @@
 #ifndef CLBL_INVOCATION_DATA_H
 #define CLBL_INVOCATION_DATA_H
 
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include <CLBL/utility.h>
+#include <CLBL/apply_qualifiers.h>
+#include <CLBL/compact_pmf.h>
+#include <CLBL/harden_cast.h>
+#include <CLBL/member_function_decay.h>
 
 namespace clbl {
 
@@ -13,6 +22,16 @@ namespace clbl {
          - pointers to objects
          - function pointers
          - member function pointers
+
+    Copying from volatile instances goes through constructor templates, so that these
+    types (and the wrappers holding them) stay trivially copyable whenever their
+    members are.
+
+    Objects are stored without the CV flags of the wrapper holding them - the flags are
+    applied with harden_cast at call time - so an rvalue wrapper can always be moved from.
+
+    The constructors are constexpr, so that wrappers around literal types can be created
+    and called in constant expressions. The compressed types below are the exception.
     */
 
     template<typename TPtr>
@@ -25,27 +44,32 @@ namespace clbl {
         inline ptr_invocation_data(const my_type&) = default;
         inline ptr_invocation_data(my_type&&) = default;
 
-        inline ptr_invocation_data(volatile my_type& other)
-            : ptr{ other.ptr }
-        {}
-
-        inline ptr_invocation_data(const volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr ptr_invocation_data(Other& other)
             : ptr{ other.ptr }
         {}
 
-        inline ptr_invocation_data(std::remove_const_t<TPtr>& p)
+        inline constexpr ptr_invocation_data(std::remove_const_t<TPtr>& p)
             : ptr{ p }
         {}
 
-        inline ptr_invocation_data(const TPtr& p)
+        inline constexpr ptr_invocation_data(const TPtr& p)
             : ptr{ p }
 
         {}
-        inline ptr_invocation_data(TPtr&& p)
+        inline constexpr ptr_invocation_data(TPtr&& p)
             : ptr{ std::forward<TPtr>(p) }
         {}
     };
 
+    template<typename TPtr, TPtr Ptr>
+    struct ptr_invocation_data_slim {
+        static constexpr auto ptr = Ptr;
+
+        using my_type = ptr_invocation_data_slim<TPtr, Ptr>;
+    };
+
     template<typename T>
     struct object_invocation_data {
         T object;
@@ -56,23 +80,21 @@ namespace clbl {
         inline object_invocation_data(const my_type&) = default;
         inline object_invocation_data(my_type&&) = default;
 
-        inline object_invocation_data(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr object_invocation_data(Other& other)
             : object{ other.object }
         {}
 
-        inline object_invocation_data(const volatile my_type& other)
-            : object{ other.object }
-        {}
-
-        inline object_invocation_data(std::remove_const_t<T>& o)
+        inline constexpr object_invocation_data(std::remove_const_t<T>& o)
             : object{ o }
         {}
 
-        inline object_invocation_data(const T& o)
+        inline constexpr object_invocation_data(const T& o)
             : object{ o }
         {}
 
-        inline object_invocation_data(T&& o)
+        inline constexpr object_invocation_data(T&& o)
             : object{ std::forward<T>(o) }
         {}
     };
@@ -88,30 +110,28 @@ namespace clbl {
         inline pmf_invocation_data(const my_type&) = default;
         inline pmf_invocation_data(my_type&&) = default;
 
-        inline pmf_invocation_data(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr pmf_invocation_data(Other& other)
             : pmf{ other.pmf }, object{ other.object }
         {}
 
-        inline pmf_invocation_data(const volatile my_type& other)
-            : pmf{ other.pmf }, object{ other.object }
-        {}
-
-        inline pmf_invocation_data(TMemberFnPtr p, std::remove_const_t<T>& o)
+        inline constexpr pmf_invocation_data(TMemberFnPtr p, std::remove_const_t<T>& o)
             : pmf{ p }, object{ o }
         {}
 
-        inline pmf_invocation_data(TMemberFnPtr p, const T& o)
+        inline constexpr pmf_invocation_data(TMemberFnPtr p, const T& o)
             : pmf{ p }, object{ o }
 
         {}
-        inline pmf_invocation_data(TMemberFnPtr p, T&& o)
+        inline constexpr pmf_invocation_data(TMemberFnPtr p, T&& o)
             : pmf{ p }, object{ std::forward<T>(o) }
         {}
     };
 
     template<typename T, typename TMemberFnPtr, TMemberFnPtr Pmf>
     struct pmf_invocation_data_slim {
-        static constexpr auto pmf = Pmf;
+        static constexpr TMemberFnPtr pmf = Pmf;
         T object;
 
         using my_type = pmf_invocation_data_slim<T, TMemberFnPtr, Pmf>;
@@ -120,27 +140,29 @@ namespace clbl {
         inline pmf_invocation_data_slim(const my_type&) = default;
         inline pmf_invocation_data_slim(my_type&&) = default;
 
-        inline pmf_invocation_data_slim(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr pmf_invocation_data_slim(Other& other)
             : object{ other.object }
         {}
 
-        inline pmf_invocation_data_slim(const volatile my_type& other)
-            : object{ other.object }
-        {}
-
-        inline pmf_invocation_data_slim(std::remove_const_t<T>& o)
+        inline constexpr pmf_invocation_data_slim(std::remove_const_t<T>& o)
             : object{ o }
         {}
 
-        inline pmf_invocation_data_slim(const T& o)
+        inline constexpr pmf_invocation_data_slim(const T& o)
             : object{ o }
 
         {}
-        inline pmf_invocation_data_slim(T&& o)
+        inline constexpr pmf_invocation_data_slim(T&& o)
             : object{ std::forward<T>(o) }
         {}
     };
 
+    //pre-C++17, pmf needs a definition wherever it is odr-used (e.g. for lambdas defined in a function)
+    template<typename T, typename TMemberFnPtr, TMemberFnPtr Pmf>
+    constexpr TMemberFnPtr pmf_invocation_data_slim<T, TMemberFnPtr, Pmf>::pmf;
+
     template<typename TPtr, typename TMemberFnPtr>
     struct indirect_pmf_invocation_data {
         TMemberFnPtr pmf;
@@ -152,30 +174,140 @@ namespace clbl {
         inline indirect_pmf_invocation_data(const my_type&) = default;
         inline indirect_pmf_invocation_data(my_type&&) = default;
 
-        inline indirect_pmf_invocation_data(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr indirect_pmf_invocation_data(Other& other)
             : pmf{ other.pmf }, object_ptr{ other.object_ptr }
         {}
 
-        inline indirect_pmf_invocation_data(const volatile my_type& other)
-            : pmf{ other.pmf }, object_ptr{ other.object_ptr }
-        {}
-
-        inline indirect_pmf_invocation_data(TMemberFnPtr p, std::remove_const_t<TPtr>& o)
+        inline constexpr indirect_pmf_invocation_data(TMemberFnPtr p, std::remove_const_t<TPtr>& o)
             : pmf{ p }, object_ptr{ o }
         {}
 
-        inline indirect_pmf_invocation_data(TMemberFnPtr p, const TPtr& o)
+        inline constexpr indirect_pmf_invocation_data(TMemberFnPtr p, const TPtr& o)
             : pmf{ p }, object_ptr{ o }
         {}
 
-        inline indirect_pmf_invocation_data(TMemberFnPtr p, TPtr&& o)
+        inline constexpr indirect_pmf_invocation_data(TMemberFnPtr p, TPtr&& o)
             : pmf{ p }, object_ptr{ std::forward<TPtr>(o) }
         {}
     };
 
+    /*
+    compressed_pmf_invocation_data takes the place of indirect_pmf_invocation_data for
+    raw pointers to classes without virtual functions when CLBL_COMPACT_PMF is enabled
+    (see CLBL/compact_pmf.h). A PMF of such a class can't be virtual, so it is decoded
+    once, on construction, into a plain function pointer, and object_ptr is stored with
+    the "this" adjustment already applied. This takes 16 bytes instead of 24, and a call
+    doesn't check whether the PMF is virtual. Polymorphic classes keep
+    indirect_pmf_invocation_data. Decoding the PMF can't be done in a constant
+    expression - use CLBL_PMFWRAP for compile-time pointer wrappers.
+    */
+    template<typename TPtr, typename TMemberFnPtr, typename FunctionType>
+    struct compressed_pmf_invocation_data;
+
+#if CLBL_COMPACT_PMF
+    template<typename T, typename TMemberFnPtr, typename Return, typename... Args>
+    struct compressed_pmf_invocation_data<T*, TMemberFnPtr, Return(Args...)> {
+
+        static_assert(!std::is_polymorphic<T>::value,
+            "A PMF of a polymorphic class may be virtual. Use indirect_pmf_invocation_data.");
+
+        Return(*fn)(void*, Args...);
+        void* object_ptr;
+
+        using my_type = compressed_pmf_invocation_data<T*, TMemberFnPtr, Return(Args...)>;
+
+        inline compressed_pmf_invocation_data(my_type&) = default;
+        inline compressed_pmf_invocation_data(const my_type&) = default;
+        inline compressed_pmf_invocation_data(my_type&&) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline compressed_pmf_invocation_data(Other& other)
+            : fn{ other.fn }, object_ptr{ other.object_ptr }
+        {}
+
+        inline compressed_pmf_invocation_data(TMemberFnPtr p, T* o)
+            : fn{ detail::compact_pmf_function<Return, Args...>(p) }, object_ptr{ detail::compact_pmf_object(p, o) }
+        {}
+
+        //invoke is noexcept when the PMF is - cast with the PMF's own ref-qualifier, which is always valid
+        template<typename... Fargs>
+        inline Return invoke(Fargs&&... a) const volatile
+            noexcept(noexcept((harden_cast<member_ref_flags<TMemberFnPtr> >(std::declval<T&>()).*std::declval<TMemberFnPtr>())(
+                std::forward<Fargs>(a)...))) {
+            return fn(object_ptr, std::forward<Fargs>(a)...);
+        }
+    };
+#endif
+
+    /*
+    devirtualized_pmf_invocation_data has the layout of compressed_pmf_invocation_data,
+    but also takes polymorphic classes: a virtual member function is resolved to the
+    final overrider of the object once, on construction, instead of on every call. This is only
+    correct as long as the dynamic type of the object doesn't change, so it is opt-in
+    (see clbl::devirtualize). fn may be a "this"-adjusting thunk, which doesn't have to
+    be aligned, so it can't be turned back into a PMF.
+    */
+    template<typename TPtr, typename TMemberFnPtr, typename FunctionType>
+    struct devirtualized_pmf_invocation_data;
+
+#if CLBL_COMPACT_PMF
+    template<typename T, typename TMemberFnPtr, typename Return, typename... Args>
+    struct devirtualized_pmf_invocation_data<T*, TMemberFnPtr, Return(Args...)> {
+        Return(*fn)(void*, Args...);
+        void* object_ptr;
+
+        using my_type = devirtualized_pmf_invocation_data<T*, TMemberFnPtr, Return(Args...)>;
+
+        inline devirtualized_pmf_invocation_data(my_type&) = default;
+        inline devirtualized_pmf_invocation_data(const my_type&) = default;
+        inline devirtualized_pmf_invocation_data(my_type&&) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline devirtualized_pmf_invocation_data(Other& other)
+            : fn{ other.fn }, object_ptr{ other.object_ptr }
+        {}
+
+        /*
+        When p is virtual, o must point to a live object, because its vtable is read
+        here. A non-virtual p doesn't touch the object, so o may be null, as long as
+        the wrapper isn't called
+        */
+        inline devirtualized_pmf_invocation_data(TMemberFnPtr p, T* o)
+            : devirtualized_pmf_invocation_data(detail::compact_pmf_code(p), detail::compact_pmf_object(p, o))
+        {}
+
+        //code is a compact PMF code, and adjusted_object is already adjusted for it
+        inline devirtualized_pmf_invocation_data(std::uintptr_t code, void* adjusted_object)
+            : fn{ detail::resolve_compact_pmf<Return, Args...>(code, adjusted_object) },
+              object_ptr{ adjusted_object }
+        {}
+
+        //invoke is noexcept when the PMF is - cast with the PMF's own ref-qualifier, which is always valid
+        template<typename... Fargs>
+        inline Return invoke(Fargs&&... a) const volatile
+            noexcept(noexcept((harden_cast<member_ref_flags<TMemberFnPtr> >(std::declval<T&>()).*std::declval<TMemberFnPtr>())(
+                std::forward<Fargs>(a)...))) {
+            return fn(object_ptr, std::forward<Fargs>(a)...);
+        }
+    };
+#endif
+
+    /*
+    clbl::member_fn_ptr_of returns a PMF that can be called on the object_ptr
+    of indirect PMF invocation data
+    */
+    template<typename TPtr, typename TMemberFnPtr>
+    inline TMemberFnPtr member_fn_ptr_of(const volatile indirect_pmf_invocation_data<TPtr, TMemberFnPtr>& data) {
+        return data.pmf;
+    }
+
     template<typename TPtr, typename TMemberFnPtr, TMemberFnPtr Pmf>
     struct indirect_pmf_invocation_data_slim {
-        static constexpr auto pmf = Pmf;
+        static constexpr TMemberFnPtr pmf = Pmf;
         TPtr object_ptr;
 
         using my_type = indirect_pmf_invocation_data_slim<TPtr, TMemberFnPtr, Pmf>;
@@ -184,30 +316,31 @@ namespace clbl {
         inline indirect_pmf_invocation_data_slim(const my_type&) = default;
         inline indirect_pmf_invocation_data_slim(my_type&&) = default;
 
-        inline indirect_pmf_invocation_data_slim(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr indirect_pmf_invocation_data_slim(Other& other)
             : object_ptr{ other.object_ptr }
         {}
 
-        inline indirect_pmf_invocation_data_slim(const volatile my_type& other)
-            : object_ptr{ other.object_ptr }
-        {}
-
-        inline indirect_pmf_invocation_data_slim(std::remove_const_t<TPtr>& o)
+        inline constexpr indirect_pmf_invocation_data_slim(std::remove_const_t<TPtr>& o)
             : object_ptr{ o }
         {}
 
-        inline indirect_pmf_invocation_data_slim(const TPtr& o)
+        inline constexpr indirect_pmf_invocation_data_slim(const TPtr& o)
             : object_ptr{ o }
 
         {}
-        inline indirect_pmf_invocation_data_slim(TPtr&& o)
+        inline constexpr indirect_pmf_invocation_data_slim(TPtr&& o)
             : object_ptr{ std::forward<TPtr>(o) }
         {}
     };
 
+    template<typename TPtr, typename TMemberFnPtr, TMemberFnPtr Pmf>
+    constexpr TMemberFnPtr indirect_pmf_invocation_data_slim<TPtr, TMemberFnPtr, Pmf>::pmf;
+
     template<typename TPtr, typename UnderlyingType, typename TMemberFnPtr>
     struct object_pointer_casted_invocation_data {
-        static constexpr auto pmf = static_cast<TMemberFnPtr>(&UnderlyingType::operator());
+        static constexpr TMemberFnPtr pmf = static_cast<TMemberFnPtr>(&UnderlyingType::operator());
         TPtr object_ptr;
 
         using my_type = object_pointer_casted_invocation_data<TPtr, UnderlyingType, TMemberFnPtr>;
@@ -216,30 +349,31 @@ namespace clbl {
         inline object_pointer_casted_invocation_data(const my_type&) = default;
         inline object_pointer_casted_invocation_data(my_type&&) = default;
 
-        inline object_pointer_casted_invocation_data(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr object_pointer_casted_invocation_data(Other& other)
             : object_ptr{ other.object_ptr }
         {}
 
-        inline object_pointer_casted_invocation_data(const volatile my_type& other)
-            : object_ptr{ other.object_ptr }
-        {}
-
-        inline object_pointer_casted_invocation_data(std::remove_const_t<TPtr>& o)
+        inline constexpr object_pointer_casted_invocation_data(std::remove_const_t<TPtr>& o)
             : object_ptr{ o }
         {}
 
-        inline object_pointer_casted_invocation_data(const TPtr& o)
+        inline constexpr object_pointer_casted_invocation_data(const TPtr& o)
             : object_ptr{ o }
 
         {}
-        inline object_pointer_casted_invocation_data(TPtr&& o)
+        inline constexpr object_pointer_casted_invocation_data(TPtr&& o)
             : object_ptr{ std::forward<TPtr>(o) }
         {}
     };
 
+    template<typename TPtr, typename UnderlyingType, typename TMemberFnPtr>
+    constexpr TMemberFnPtr object_pointer_casted_invocation_data<TPtr, UnderlyingType, TMemberFnPtr>::pmf;
+
     template<typename T, typename TMemberFnPtr>
     struct object_casted_invocation_data {
-        static constexpr auto pmf = static_cast<TMemberFnPtr>(&no_ref<T>::operator());
+        static constexpr TMemberFnPtr pmf = static_cast<TMemberFnPtr>(&no_ref<T>::operator());
         T object;
 
         using my_type = object_casted_invocation_data<T, TMemberFnPtr>;
@@ -248,26 +382,205 @@ namespace clbl {
         inline object_casted_invocation_data(const my_type&) = default;
         inline object_casted_invocation_data(my_type&&) = default;
 
-        inline object_casted_invocation_data(volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr object_casted_invocation_data(Other& other)
             : object{ other.object }
         {}
 
-        inline object_casted_invocation_data(const volatile my_type& other)
-            : object{ other.object }
-        {}
-
-        inline object_casted_invocation_data(std::remove_const_t<T>& o)
+        inline constexpr object_casted_invocation_data(std::remove_const_t<T>& o)
             : object{ o }
         {}
 
-        inline object_casted_invocation_data(const T& o)
+        inline constexpr object_casted_invocation_data(const T& o)
             : object{ o }
 
         {}
-        inline object_casted_invocation_data(T&& o)
+        inline constexpr object_casted_invocation_data(T&& o)
             : object{ std::forward<T>(o) }
         {}
     };
+
+    template<typename T, typename TMemberFnPtr>
+    constexpr TMemberFnPtr object_casted_invocation_data<T, TMemberFnPtr>::pmf;
+
+    namespace detail {
+
+        //the qualify_flags of a reference type, e.g. qflags::const_ | qflags::rvalue_reference_ for const T&&
+        template<typename Ref>
+        constexpr qualify_flags qualifiers_of =
+            (std::is_const<no_ref<Ref> >::value ? qflags::const_ : qflags::default_)
+            | (std::is_volatile<no_ref<Ref> >::value ? qflags::volatile_ : qflags::default_)
+            | (std::is_lvalue_reference<Ref>::value ? qflags::lvalue_reference_ : qflags::rvalue_reference_);
+
+        /*
+        bound_element holds the I-th object of a bound_invocation_data. Empty objects
+        are held as a base class instead of a member, so they take no space (EBO).
+        get returns the object with the qualifiers and value category of the element.
+        */
+        template<std::size_t I, typename T, bool = std::is_empty<T>::value && !std::is_final<T>::value>
+        struct bound_element {
+            T value;
+
+            template<typename U>
+            inline constexpr bound_element(dummy, U&& u)
+                : value(std::forward<U>(u))
+            {}
+
+            template<typename Other, std::enable_if_t<
+                is_volatile_copy_of<bound_element, Other>, dummy>* = nullptr>
+            inline constexpr bound_element(Other& other)
+                : value(other.value)
+            {}
+
+            template<typename Self>
+            static inline constexpr auto&& get(Self&& self) noexcept {
+                return std::forward<Self>(self).value;
+            }
+        };
+
+        template<std::size_t I, typename T>
+        struct bound_element<I, T, true> : T {
+
+            template<typename U>
+            inline constexpr bound_element(dummy, U&& u)
+                : T(std::forward<U>(u))
+            {}
+
+            //an empty object has no state to read, so volatile can be cast away
+            template<typename Other, std::enable_if_t<
+                is_volatile_copy_of<bound_element, Other>, dummy>* = nullptr>
+            inline constexpr bound_element(Other& other)
+                : T(const_cast<const T&>(static_cast<const volatile T&>(other)))
+            {}
+
+            template<typename Self>
+            static inline constexpr auto&& get(Self&& self) noexcept {
+                return static_cast<apply_qualifiers<T, qualifiers_of<Self&&> > >(self);
+            }
+        };
+
+        template<typename Indices, typename... T>
+        struct bound_elements;
+
+        template<std::size_t... I, typename... T>
+        struct bound_elements<std::index_sequence<I...>, T...> : bound_element<I, T>... {
+
+            template<typename... U>
+            inline constexpr bound_elements(dummy d, U&&... u)
+                : bound_element<I, T>(d, std::forward<U>(u))...
+            {}
+
+            template<typename Other, std::enable_if_t<
+                is_volatile_copy_of<bound_elements, Other>, dummy>* = nullptr>
+            inline constexpr bound_elements(Other& other)
+                : bound_element<I, T>(static_cast<apply_qualifiers<bound_element<I, T>, qualifiers_of<Other&> > >(other))...
+            {}
+        };
+    }
+
+    /*
+    bound_invocation_data holds a CLBL wrapper and the arguments bound to the front
+    of its parameter list (see clbl::bind_front), side by side, with no indirection.
+    Use clbl::bound_get to access them - element 0 is the wrapper.
+    */
+    template<typename Callable, typename... BoundArgs>
+    struct bound_invocation_data
+        : detail::bound_elements<std::index_sequence_for<Callable, BoundArgs...>, Callable, BoundArgs...> {
+
+        using base_type = detail::bound_elements<std::index_sequence_for<Callable, BoundArgs...>, Callable, BoundArgs...>;
+        using my_type = bound_invocation_data<Callable, BoundArgs...>;
+        using bound_indices = std::index_sequence_for<BoundArgs...>;
+
+        template<std::size_t I>
+        using element_type = detail::bound_element<I, std::tuple_element_t<I, std::tuple<Callable, BoundArgs...> > >;
+
+        inline bound_invocation_data(my_type&) = default;
+        inline bound_invocation_data(const my_type&) = default;
+        inline bound_invocation_data(my_type&&) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr bound_invocation_data(Other& other)
+            : base_type(static_cast<apply_qualifiers<base_type, detail::qualifiers_of<Other&> > >(other))
+        {}
+
+        template<typename C, typename... Args>
+        inline constexpr bound_invocation_data(dummy d, C&& c, Args&&... args)
+            : base_type(d, std::forward<C>(c), std::forward<Args>(args)...)
+        {}
+    };
+
+    /*
+    composed_invocation_data holds the stages of a clbl::compose pipeline, side by
+    side, in the same way. clbl::bound_get(I) is stage I.
+    */
+    template<typename... Stages>
+    struct composed_invocation_data
+        : detail::bound_elements<std::index_sequence_for<Stages...>, Stages...> {
+
+        using base_type = detail::bound_elements<std::index_sequence_for<Stages...>, Stages...>;
+        using my_type = composed_invocation_data<Stages...>;
+
+        static constexpr std::size_t stage_count = sizeof...(Stages);
+
+        template<std::size_t I>
+        using element_type = detail::bound_element<I, std::tuple_element_t<I, std::tuple<Stages...> > >;
+
+        inline composed_invocation_data(my_type&) = default;
+        inline composed_invocation_data(const my_type&) = default;
+        inline composed_invocation_data(my_type&&) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr composed_invocation_data(Other& other)
+            : base_type(static_cast<apply_qualifiers<base_type, detail::qualifiers_of<Other&> > >(other))
+        {}
+
+        template<typename... Args>
+        inline constexpr composed_invocation_data(dummy d, Args&&... stages)
+            : base_type(d, std::forward<Args>(stages)...)
+        {}
+    };
+
+    /*
+    decorated_invocation_data holds a CLBL wrapper and the advice objects that
+    decorate it (see clbl::decorate) in the same way. Element 0 is the wrapper,
+    and element I is the I-th advice object, outermost first.
+    */
+    template<typename Callable, typename... Advice>
+    struct decorated_invocation_data
+        : detail::bound_elements<std::index_sequence_for<Callable, Advice...>, Callable, Advice...> {
+
+        using base_type = detail::bound_elements<std::index_sequence_for<Callable, Advice...>, Callable, Advice...>;
+        using my_type = decorated_invocation_data<Callable, Advice...>;
+
+        static constexpr std::size_t advice_count = sizeof...(Advice);
+
+        template<std::size_t I>
+        using element_type = detail::bound_element<I, std::tuple_element_t<I, std::tuple<Callable, Advice...> > >;
+
+        inline decorated_invocation_data(my_type&) = default;
+        inline decorated_invocation_data(const my_type&) = default;
+        inline decorated_invocation_data(my_type&&) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr decorated_invocation_data(Other& other)
+            : base_type(static_cast<apply_qualifiers<base_type, detail::qualifiers_of<Other&> > >(other))
+        {}
+
+        template<typename C, typename... Args>
+        inline constexpr decorated_invocation_data(dummy d, C&& c, Args&&... advice)
+            : base_type(d, std::forward<C>(c), std::forward<Args>(advice)...)
+        {}
+    };
+
+    template<std::size_t I, typename Data>
+    inline constexpr auto&& bound_get(Data&& d) noexcept {
+        using element = typename no_ref<Data>::template element_type<I>;
+        return element::get(static_cast<apply_qualifiers<element, detail::qualifiers_of<Data&&> > >(d));
+    }
 }
 
 #endif
\ No newline at end of file
@@ -9,7 +9,8 @@ are temporary and will be hand-replaced in the future.
 #define CLBL_CALL_PTR(cv_ignored, ptr, args) (*ptr)(args)
 #define CLBL_UPCAST_AND_CALL_PTR(qual, ptr, args) harden_cast<cv<qual dummy> | cv_flags>(*ptr)(args)
 #define CLBL_UPCAST_AND_CALL_VAL(qual, val, args) harden_cast<cv<qual dummy> | cv_flags>(val)(args)
-#define CLBL_UPCAST_AND_CALL_MEMBER_PTR(qual, optr, member, args)(harden_cast<cv<qual dummy> | cv_flags>(*optr).*member)(args)
-#define CLBL_UPCAST_AND_CALL_MEMBER_VAL(qual, obj, member, args) (harden_cast<cv<qual dummy> | cv_flags>(obj).*member)(args)
+#define CLBL_UPCAST_AND_CALL_MEMBER_PTR(qual, optr, member, args) detail::invoke_member_ptr<cv<qual dummy> | cv_flags | member_object_flags<decltype(member)> >(optr, member, args)
+#define CLBL_UPCAST_AND_CALL_MEMBER_VAL(qual, obj, member, args) detail::invoke_member<cv<qual dummy> | cv_flags | member_object_flags<decltype(member)> >(obj, member, args)
+#define CLBL_UPCAST_AND_CALL_INVOCATION_DATA(qual, d, args) invoke_data<cv<qual dummy> | cv_flags>(d, args)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,152 @@
+#ifndef CLBL_INVOKE_BATCH_H
+#define CLBL_INVOKE_BATCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/utility.h>
+
+namespace clbl {
+
+    /*
+    clbl::invoke_batch calls a callable (usually a CLBL wrapper) once per element
+    of contiguous argument buffers, and writes each result to an output buffer:
+
+        //array-of-structures - one std::tuple (or std::pair, std::array) per call
+        std::vector<std::tuple<float, float> > rows = ...;
+        std::vector<float> scores(rows.size());
+        clbl::invoke_batch(score, rows, scores);
+
+        //structure-of-arrays - one column per parameter
+        clbl::invoke_batch(score, clbl::columns(prices, weights), scores);
+
+    Buffers are anything with data() and size() (std::vector, std::array,
+    std::basic_string, std::span...) or built-in arrays. The batch covers the
+    shortest buffer, and invoke_batch returns its length. Without an output buffer,
+    the results (if any) are discarded.
+
+    The wrapper is bound as an lvalue once per batch, so the CV overload and the
+    harden_cast it implies are chosen at compile time, and each element is a direct
+    call through raw pointers with no per-call dispatch. For a target that inlines,
+    that leaves a plain counted loop the compiler can vectorize - especially over
+    columns, where each argument is a unit-stride load.
+    */
+
+    namespace detail {
+
+        template<typename Range>
+        inline constexpr auto range_data(Range& r) -> decltype(r.data()) { return r.data(); }
+
+        template<typename T, std::size_t N>
+        inline constexpr T* range_data(T(&r)[N]) { return r; }
+
+        template<typename Range>
+        inline constexpr auto range_size(Range& r) -> decltype(std::size_t(r.size())) { return r.size(); }
+
+        template<typename T, std::size_t N>
+        inline constexpr std::size_t range_size(T(&)[N]) { return N; }
+
+        template<typename Range>
+        using range_element = std::remove_reference_t<decltype(*range_data(std::declval<Range&>()))>;
+
+        template<typename F, typename Row, typename Out, std::size_t... I>
+        inline void invoke_rows(F& f, Row* rows, Out* out, std::size_t n, std::index_sequence<I...>) {
+            for (std::size_t i = 0; i != n; ++i)
+                out[i] = f(std::get<I>(rows[i])...);
+        }
+
+        template<typename F, typename Row, std::size_t... I>
+        inline void invoke_rows(F& f, Row* rows, std::size_t n, std::index_sequence<I...>) {
+            for (std::size_t i = 0; i != n; ++i)
+                f(std::get<I>(rows[i])...);
+        }
+
+        template<typename F, typename Out, typename... Columns>
+        inline void invoke_columns(F& f, Out* out, std::size_t n, Columns*... columns) {
+            for (std::size_t i = 0; i != n; ++i)
+                out[i] = f(columns[i]...);
+        }
+
+        template<typename F, typename... Columns>
+        inline void invoke_columns(F& f, std::nullptr_t, std::size_t n, Columns*... columns) {
+            for (std::size_t i = 0; i != n; ++i)
+                f(columns[i]...);
+        }
+
+        template<typename Row>
+        using row_indices = std::make_index_sequence<std::tuple_size<std::remove_cv_t<Row> >::value>;
+    }
+
+    //clbl::column_set is a structure-of-arrays argument buffer (see clbl::columns)
+    template<typename... T>
+    struct column_set {
+        std::tuple<T*...> data;
+        std::size_t size;
+    };
+
+    template<typename... Ranges>
+    inline constexpr column_set<detail::range_element<Ranges>...>
+    columns(Ranges&&... ranges) {
+        static_assert(sizeof...(Ranges) > 0, "clbl::columns needs at least one column.");
+        return { std::tuple<detail::range_element<Ranges>*...>{ detail::range_data(ranges)... },
+            std::min({ detail::range_size(ranges)... }) };
+    }
+
+    //array-of-structures, with results
+    template<typename Callable, typename Rows, typename Out>
+    inline auto
+    invoke_batch(Callable&& c, Rows&& rows, Out&& out)
+        -> decltype(detail::range_size(rows), detail::range_size(out)) {
+        auto& f = c;
+        auto n = std::min<std::size_t>(detail::range_size(rows), detail::range_size(out));
+        detail::invoke_rows(f, detail::range_data(rows), detail::range_data(out), n,
+            detail::row_indices<detail::range_element<Rows> >{});
+        return n;
+    }
+
+    //array-of-structures, results discarded
+    template<typename Callable, typename Rows>
+    inline auto
+    invoke_batch(Callable&& c, Rows&& rows)
+        -> decltype(detail::range_size(rows)) {
+        auto& f = c;
+        auto n = detail::range_size(rows);
+        detail::invoke_rows(f, detail::range_data(rows), n,
+            detail::row_indices<detail::range_element<Rows> >{});
+        return n;
+    }
+
+    namespace detail {
+
+        template<typename F, typename Out, typename... T, std::size_t... I>
+        inline void invoke_column_set(F& f, Out out, std::size_t n,
+            const column_set<T...>& set, std::index_sequence<I...>) {
+            invoke_columns(f, out, n, std::get<I>(set.data)...);
+        }
+    }
+
+    //structure-of-arrays, with results
+    template<typename Callable, typename... T, typename Out>
+    inline auto
+    invoke_batch(Callable&& c, const column_set<T...>& set, Out&& out)
+        -> decltype(detail::range_size(out)) {
+        auto& f = c;
+        auto n = std::min<std::size_t>(set.size, detail::range_size(out));
+        detail::invoke_column_set(f, detail::range_data(out), n, set, std::index_sequence_for<T...>{});
+        return n;
+    }
+
+    //structure-of-arrays, results discarded
+    template<typename Callable, typename... T>
+    inline std::size_t
+    invoke_batch(Callable&& c, const column_set<T...>& set) {
+        auto& f = c;
+        detail::invoke_column_set(f, nullptr, set.size, set, std::index_sequence_for<T...>{});
+        return set.size;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -3,57 +3,146 @@
 
 #include<type_traits>
 
+#include <CLBL/qualify_flags.h>
+#include <CLBL/tags.h>
+
 /*
 we use the member_function_decay metafunction to strip
 qualifiers from PMFs, which allows us to use partial 
-template specializations to break down signatures
+template specializations to break down signatures.
+
+member_function_decay_t<T>::function_type is the signature without
+the class. member_function_decay_t<T>::ref_flags remembers the
+ref-qualifier, so that the object can be passed with the value
+category the PMF needs. Since C++17, noexcept is part of the type, so it is stripped
+too - member_function_decay_t<T>::is_noexcept remembers it.
+function_decay does the same for plain function types.
 */
 
-#define __SPECIALIZE_MEMBER_FUNCTION_DECAY(qualifiers) \
+#define __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(qualifiers, ref, nothrow) \
     template<typename T, typename Return, typename... Args> \
-    struct member_function_decay_t<Return(T::*)(Args...) qualifiers> { using type = Return(T::*)(Args...); }
+    struct member_function_decay_t<Return(T::*)(Args...) qualifiers> { \
+        using type = Return(T::*)(Args...); \
+        using function_type = Return(Args...); \
+        static constexpr qualify_flags ref_flags = ref; \
+        static constexpr bool is_noexcept = nothrow; \
+    }
 
-#define __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(qualifiers) \
+#define __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(qualifiers, ref, nothrow) \
     template<typename T, typename Return, typename... Args> \
-    struct member_function_decay_t<Return(T::*)(Args...,...) qualifiers> { using type = Return(T::*)(Args...,...); }
+    struct member_function_decay_t<Return(T::*)(Args...,...) qualifiers> { \
+        using type = Return(T::*)(Args...,...); \
+        using function_type = Return(Args...,...); \
+        static constexpr qualify_flags ref_flags = ref; \
+        static constexpr bool is_noexcept = nothrow; \
+    }
+
+#define __SPECIALIZE_MEMBER_FUNCTION_DECAY(qualifiers, ref) \
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(qualifiers, ref, false)
+
+#define __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(qualifiers, ref) \
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(qualifiers, ref, false)
 
 namespace clbl {
 
     //primary template fails silently
-    template<typename Other> struct member_function_decay_t { using type = Other; };
-
-    template<typename T, typename Return, typename... Args>
-    struct member_function_decay_t<Return(T::*)(Args...)> { using type = Return(T::*)(Args...); };
-
-    template<typename T, typename Return, typename... Args>
-    struct member_function_decay_t<Return(T::*)(Args..., ...)> { using type = Return(T::*)(Args..., ...); };
-
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(&&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(volatile);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const volatile);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const &);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(volatile &);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const volatile &);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const &&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(volatile &&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const volatile &&);
-
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(&&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(volatile);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const volatile);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const &);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(volatile &);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const volatile &);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const &&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(volatile &&);
-    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const volatile &&);
+    template<typename Other> struct member_function_decay_t {
+        using type = Other;
+        using function_type = Other;
+        static constexpr qualify_flags ref_flags = qflags::default_;
+        static constexpr bool is_noexcept = false;
+    };
+
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(__CLBL_NO_CV, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(__CLBL_NO_CV, qflags::default_);
+
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(&, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(&&, qflags::rvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(volatile, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const volatile, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const &, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(volatile &, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const volatile &, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const &&, qflags::rvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(volatile &&, qflags::rvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY(const volatile &&, qflags::rvalue_reference_);
+
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(&, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(&&, qflags::rvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(volatile, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const volatile, qflags::default_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const &, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(volatile &, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const volatile &, qflags::lvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const &&, qflags::rvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(volatile &&, qflags::rvalue_reference_);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES(const volatile &&, qflags::rvalue_reference_);
+
+#ifdef __cpp_noexcept_function_type
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(__CLBL_NO_CV noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(& noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(&& noexcept, qflags::rvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(const noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(volatile noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(const volatile noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(const & noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(volatile & noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(const volatile & noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(const && noexcept, qflags::rvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(volatile && noexcept, qflags::rvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_IMPL(const volatile && noexcept, qflags::rvalue_reference_, true);
+
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(__CLBL_NO_CV noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(& noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(&& noexcept, qflags::rvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(const noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(volatile noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(const volatile noexcept, qflags::default_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(const & noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(volatile & noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(const volatile & noexcept, qflags::lvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(const && noexcept, qflags::rvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(volatile && noexcept, qflags::rvalue_reference_, true);
+    __SPECIALIZE_MEMBER_FUNCTION_DECAY_ELLIPSES_IMPL(const volatile && noexcept, qflags::rvalue_reference_, true);
+#endif
 
     template<typename T>
     using member_function_decay = typename member_function_decay_t<T>::type;
+
+    /*
+    clbl::member_ref_flags is the reference flag an object must be cast with to
+    call a PMF of type T (qflags::default_ when T isn't ref-qualified)
+    */
+    template<typename T>
+    constexpr qualify_flags member_ref_flags = member_function_decay_t<std::remove_cv_t<std::remove_reference_t<T> > >::ref_flags;
+
+    /*
+    clbl::member_object_flags is the reference flag an object is cast with before
+    calling a PMF of type T through it. Only an &-qualified PMF forces a cast - the
+    object of an &&-qualified PMF keeps the value category that the wrapper's own
+    operator() overload gives it, so calling an lvalue wrapper never moves from it
+    */
+    template<typename T>
+    constexpr qualify_flags member_object_flags = member_ref_flags<T> & qflags::lvalue_reference_;
+
+    template<typename T>
+    struct function_decay_t {
+        using type = T;
+        static constexpr bool is_noexcept = false;
+    };
+
+#ifdef __cpp_noexcept_function_type
+    template<typename Return, typename... Args>
+    struct function_decay_t<Return(Args...) noexcept> {
+        using type = Return(Args...);
+        static constexpr bool is_noexcept = true;
+    };
+#endif
+
+    template<typename T>
+    using function_decay = typename function_decay_t<T>::type;
 }
 
 #endif
\ No newline at end of file
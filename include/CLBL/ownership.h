@@ -0,0 +1,169 @@
+#ifndef CLBL_OWNERSHIP_H
+#define CLBL_OWNERSHIP_H
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/utility.h>
+
+namespace clbl {
+
+    /*
+    Ownership policies can be passed as the first argument to clbl::fwrap (or as the
+    argument after the PMF to CLBL_PMFWRAP), to choose how a pointer-based wrapper
+    (pmf_ptr_wrapper, pmf_ptr_wrapper_slim, ambi_fn_obj_ptr_wrapper) holds its object:
+
+         - clbl::borrowed stores a raw pointer to the object. The caller keeps the
+           object alive. Copies, conversions and clbl::harden never touch a reference
+           count. Owning pointers can only be borrowed from as lvalues - a temporary
+           std::unique_ptr or std::shared_ptr would destroy the object before the
+           wrapper is used.
+         - clbl::unique stores a std::unique_ptr. The wrapper is move-only, and must
+           be passed as an rvalue to clbl::convert_to (see clbl::unique_function).
+         - clbl::shared stores a std::shared_ptr. Every copy of the wrapper (including
+           the copy made by clbl::convert_to) is an atomic increment and decrement.
+         - clbl::intrusive stores a clbl::intrusive_ptr, so the count lives in the
+           object, and the object decides whether it is atomic.
+
+    The policy only decides the stored pointer type - copy_invocation and wrap_data
+    copy or move that pointer like any other.
+    */
+
+    struct borrowed_t {};
+    struct unique_t {};
+    struct shared_t {};
+    struct intrusive_t {};
+
+    constexpr borrowed_t borrowed{};
+    constexpr unique_t unique{};
+    constexpr shared_t shared{};
+    constexpr intrusive_t intrusive{};
+
+    namespace detail {
+
+        template<typename T>
+        struct is_ownership_policy_t : std::false_type {};
+
+        template<> struct is_ownership_policy_t<borrowed_t> : std::true_type {};
+        template<> struct is_ownership_policy_t<unique_t> : std::true_type {};
+        template<> struct is_ownership_policy_t<shared_t> : std::true_type {};
+        template<> struct is_ownership_policy_t<intrusive_t> : std::true_type {};
+    }
+
+    template<typename T>
+    constexpr bool is_ownership_policy = detail::is_ownership_policy_t<std::remove_cv_t<no_ref<T> > >::value;
+
+    /*
+    clbl::intrusive_ptr is a minimal intrusive smart pointer. It uses the same
+    customization points as boost::intrusive_ptr - intrusive_ptr_add_ref(T*) and
+    intrusive_ptr_release(T*), found by ADL. Moves don't touch the count.
+    */
+    template<typename T>
+    struct intrusive_ptr {
+
+        using element_type = T;
+        using my_type = intrusive_ptr<T>;
+
+        inline intrusive_ptr()
+            : ptr{ nullptr }
+        {}
+
+        inline explicit intrusive_ptr(T* p)
+            : ptr{ p } {
+            if (ptr) intrusive_ptr_add_ref(ptr);
+        }
+
+        inline intrusive_ptr(const my_type& other)
+            : ptr{ other.ptr } {
+            if (ptr) intrusive_ptr_add_ref(ptr);
+        }
+
+        inline intrusive_ptr(my_type&& other) noexcept
+            : ptr{ other.ptr } {
+            other.ptr = nullptr;
+        }
+
+        inline my_type& operator=(my_type other) noexcept {
+            std::swap(ptr, other.ptr);
+            return *this;
+        }
+
+        inline ~intrusive_ptr() {
+            if (ptr) intrusive_ptr_release(ptr);
+        }
+
+        inline T* get() const { return ptr; }
+        inline T& operator*() const { return *ptr; }
+        inline T* operator->() const { return ptr; }
+        inline explicit operator bool() const { return ptr != nullptr; }
+
+    private:
+        T* ptr;
+    };
+
+    namespace detail {
+
+        //raw pointers can be borrowed from as rvalues, owning pointers only as lvalues
+        template<typename TPtr>
+        constexpr bool is_borrowable = std::is_lvalue_reference<TPtr>::value
+                                        || std::is_pointer<no_ref<TPtr> >::value;
+
+        //borrowing only copies the address - an empty pointer stays empty, and is never dereferenced
+        template<typename T>
+        inline T* borrowed_address(T* p) {
+            return p;
+        }
+
+        template<typename TPtr>
+        inline auto borrowed_address(const TPtr& p) {
+            return p.get();
+        }
+
+        template<typename TPtr>
+        inline auto take_ownership(borrowed_t, TPtr&& p) {
+            static_assert(is_borrowable<TPtr>,
+                "clbl::borrowed cannot take a temporary owning pointer - the object would be destroyed "
+                "before the wrapper is used. Pass an lvalue, or use clbl::unique or clbl::shared.");
+            return borrowed_address(p);
+        }
+
+        template<typename T, typename Deleter>
+        inline auto take_ownership(unique_t, std::unique_ptr<T, Deleter>&& p) {
+            return std::move(p);
+        }
+
+        template<typename T>
+        inline auto take_ownership(shared_t, const std::shared_ptr<T>& p) {
+            return p;
+        }
+
+        template<typename T>
+        inline auto take_ownership(shared_t, std::shared_ptr<T>&& p) {
+            return std::move(p);
+        }
+
+        template<typename T, typename Deleter>
+        inline auto take_ownership(shared_t, std::unique_ptr<T, Deleter>&& p) {
+            return std::shared_ptr<T>{ std::move(p) };
+        }
+
+        template<typename T>
+        inline auto take_ownership(intrusive_t, T* p) {
+            return intrusive_ptr<T>{ p };
+        }
+
+        template<typename T>
+        inline auto take_ownership(intrusive_t, const intrusive_ptr<T>& p) {
+            return p;
+        }
+
+        template<typename T>
+        inline auto take_ownership(intrusive_t, intrusive_ptr<T>&& p) {
+            return std::move(p);
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -5,8 +5,9 @@ namespace clbl {
 
     /*
     qualify_flags are bitflags used to stack cv-qualifiers
-    on top of each other (ref-qualifiers are scarcely used
-    right now)
+    on top of each other. The ref-qualifier flags are only
+    used for the value category of a call - a wrapper's
+    cv_flags never contain them
     */
 
     using qualify_flags = short;
@@ -17,6 +18,9 @@ namespace clbl {
         constexpr qualify_flags volatile_ = 2;
         constexpr qualify_flags lvalue_reference_ = 4;
         constexpr qualify_flags rvalue_reference_ = 8;
+
+        constexpr qualify_flags cv_ = const_ | volatile_;
+        constexpr qualify_flags reference_ = lvalue_reference_ | rvalue_reference_;
     }
 }
 
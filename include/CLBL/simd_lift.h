@@ -0,0 +1,241 @@
+#ifndef CLBL_SIMD_LIFT_H
+#define CLBL_SIMD_LIFT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/utility.h>
+#include <CLBL/fwrap.h>
+#include <CLBL/invoke_batch.h>
+
+/*
+CLBL_SIMD_BYTES is the width of a clbl::simd pack - 32 bytes when AVX is enabled,
+16 bytes (SSE2, NEON) otherwise. CLBL_SIMD_VECTOR_EXTENSIONS selects the native
+GCC/Clang vector types; with 0 (and on other compilers), packs are plain arrays
+with element-wise operators, which the optimizer can still vectorize. Define
+either one before including CLBL to change it.
+*/
+#ifndef CLBL_SIMD_BYTES
+#if defined(__AVX__)
+#define CLBL_SIMD_BYTES 32
+#else
+#define CLBL_SIMD_BYTES 16
+#endif
+#endif
+
+#ifndef CLBL_SIMD_VECTOR_EXTENSIONS
+#if defined(__GNUC__)
+#define CLBL_SIMD_VECTOR_EXTENSIONS 1
+#else
+#define CLBL_SIMD_VECTOR_EXTENSIONS 0
+#endif
+#endif
+
+namespace clbl {
+
+    /*
+    clbl::simd_lift runs a generic callable over whole SIMD packs instead of one
+    element at a time:
+
+        auto scale = clbl::fwrap([](auto x) { return x * 2.5f + 1.f; });
+        clbl::simd_lift(scale)(clbl::columns(in), out);
+
+    Ambiguous wrappers (function objects with a templated operator()) are called
+    with clbl::simd<T> packs of clbl::simd_lanes<T> elements for every full pack,
+    and with scalars for the tail. Every column and the output must have the same
+    arithmetic element type. Whether the callable accepts packs of that type (and
+    returns one) is checked at compile time - see clbl::is_simd_liftable.
+
+    The argument and output buffers are the same as for clbl::invoke_batch.
+    */
+
+    namespace detail {
+
+        //the portable pack - element-wise operators over an array
+        template<typename T, std::size_t N>
+        struct simd_array {
+
+            T lanes[N];
+
+            inline T& operator[](std::size_t i) { return lanes[i]; }
+            inline const T& operator[](std::size_t i) const { return lanes[i]; }
+
+#define CLBL_SIMD_ARRAY_OPERATOR(op)                                                    \
+            friend inline simd_array operator op(const simd_array& l, const simd_array& r) { \
+                simd_array result;                                                      \
+                for (std::size_t i = 0; i != N; ++i) result.lanes[i] = l.lanes[i] op r.lanes[i]; \
+                return result;                                                          \
+            }                                                                           \
+            friend inline simd_array operator op(const simd_array& l, const T& r) {     \
+                simd_array result;                                                      \
+                for (std::size_t i = 0; i != N; ++i) result.lanes[i] = l.lanes[i] op r; \
+                return result;                                                          \
+            }                                                                           \
+            friend inline simd_array operator op(const T& l, const simd_array& r) {     \
+                simd_array result;                                                      \
+                for (std::size_t i = 0; i != N; ++i) result.lanes[i] = l op r.lanes[i]; \
+                return result;                                                          \
+            }
+
+            CLBL_SIMD_ARRAY_OPERATOR(+)
+            CLBL_SIMD_ARRAY_OPERATOR(-)
+            CLBL_SIMD_ARRAY_OPERATOR(*)
+            CLBL_SIMD_ARRAY_OPERATOR(/)
+
+#undef CLBL_SIMD_ARRAY_OPERATOR
+
+            friend inline simd_array operator-(const simd_array& v) {
+                simd_array result;
+                for (std::size_t i = 0; i != N; ++i) result.lanes[i] = -v.lanes[i];
+                return result;
+            }
+        };
+
+        template<typename T, bool = CLBL_SIMD_VECTOR_EXTENSIONS && std::is_arithmetic<T>::value
+                                        && !std::is_same<T, bool>::value>
+        struct simd_pack_t {
+            using type = simd_array<T, (CLBL_SIMD_BYTES / sizeof(T) > 0 ? CLBL_SIMD_BYTES / sizeof(T) : 1)>;
+        };
+
+#if CLBL_SIMD_VECTOR_EXTENSIONS
+        template<typename T>
+        struct simd_pack_t<T, true> {
+            typedef T type __attribute__((vector_size(CLBL_SIMD_BYTES)));
+        };
+#endif
+    }
+
+    template<typename T>
+    using simd = typename detail::simd_pack_t<T>::type;
+
+    template<typename T>
+    constexpr std::size_t simd_lanes = sizeof(simd<T>) / sizeof(T);
+
+    namespace detail {
+
+        template<typename Pack, typename T>
+        inline Pack simd_load(const T* p) {
+            Pack v;
+            std::memcpy(&v, p, sizeof(Pack));
+            return v;
+        }
+
+        template<typename T, typename Pack>
+        inline void simd_store(T* p, const Pack& v) {
+            std::memcpy(p, &v, sizeof(Pack));
+        }
+
+        /*
+        simd_probe is the type whose call expression decides whether a callable
+        can be lifted. The operator() of a CLBL wrapper isn't SFINAE-friendly, so
+        an unambiguous wrapper is probed through a pointer to its signature, and an
+        ambiguous one through the function object it wraps, when there is one.
+        */
+        template<typename Callable, bool = is_clbl<std::remove_cv_t<Callable> >, typename = void>
+        struct simd_probe_t {
+            using type = Callable;
+        };
+
+        template<typename Callable>
+        struct simd_probe_t<Callable, true, std::enable_if_t<!Callable::is_ambiguous> > {
+            using type = std::add_pointer_t<typename Callable::type>;
+        };
+
+        template<typename Callable>
+        struct simd_probe_t<Callable, true, std::enable_if_t<Callable::is_ambiguous
+            && !is_clbl<typename Callable::underlying_type> > > {
+            using type = std::conditional_t<std::is_const<Callable>::value,
+                const typename Callable::underlying_type, typename Callable::underlying_type>;
+        };
+
+        template<typename Callable, typename Pack, typename Arity, typename = void>
+        struct simd_liftable_t : std::false_type {};
+
+        template<typename Callable, typename Pack, std::size_t... I>
+        struct simd_liftable_t<Callable, Pack, std::index_sequence<I...>,
+            decltype(void(std::declval<typename simd_probe_t<Callable>::type&>()(
+                std::declval<std::conditional_t<true, Pack, decltype(I)> >()...)))>
+            : std::is_convertible<decltype(std::declval<typename simd_probe_t<Callable>::type&>()(
+                std::declval<std::conditional_t<true, Pack, decltype(I)> >()...)), Pack> {};
+    }
+
+    //whether Callable can be called with Arity clbl::simd<T> packs, and returns one
+    template<typename Callable, typename T, std::size_t Arity = 1>
+    constexpr bool is_simd_liftable = detail::simd_liftable_t<no_ref<Callable>, simd<T>,
+        std::make_index_sequence<Arity> >::value;
+
+    //clbl::simd_lifted is the callable returned by clbl::simd_lift
+    template<typename Callable>
+    struct simd_lifted {
+
+        Callable callable;
+
+        template<typename In, typename Out>
+        inline auto operator()(In&& in, Out&& out)
+            -> decltype(detail::range_size(in), detail::range_size(out)) {
+            return (*this)(columns(in), out);
+        }
+
+        template<typename In, typename Out>
+        inline auto operator()(In&& in, Out&& out) const
+            -> decltype(detail::range_size(in), detail::range_size(out)) {
+            return (*this)(columns(in), out);
+        }
+
+        template<typename... T, typename Out>
+        inline auto operator()(const column_set<T...>& set, Out&& out)
+            -> decltype(detail::range_size(out)) {
+            return run(callable, set, out, std::index_sequence_for<T...>{});
+        }
+
+        template<typename... T, typename Out>
+        inline auto operator()(const column_set<T...>& set, Out&& out) const
+            -> decltype(detail::range_size(out)) {
+            return run(callable, set, out, std::index_sequence_for<T...>{});
+        }
+
+    private:
+
+        template<typename F, typename... T, typename Out, std::size_t... I>
+        static inline std::size_t run(F& f, const column_set<T...>& set, Out& out, std::index_sequence<I...>) {
+
+            using element = std::remove_cv_t<detail::range_element<Out> >;
+            using pack = simd<element>;
+            constexpr auto lanes = simd_lanes<element>;
+
+            static_assert(std::is_arithmetic<element>::value,
+                "clbl::simd_lift: the output elements must be arithmetic.");
+            //the two tuples only match when every type is the same
+            static_assert(std::is_same<std::tuple<element, std::remove_cv_t<T>...>,
+                std::tuple<std::remove_cv_t<T>..., element> >::value,
+                "clbl::simd_lift: every column must have the element type of the output.");
+            static_assert(detail::simd_liftable_t<F, pack, std::index_sequence_for<T...> >::value,
+                "clbl::simd_lift: the callable can't be called with clbl::simd packs, or doesn't return one.");
+
+            auto n = std::min<std::size_t>(set.size, detail::range_size(out));
+            auto* o = detail::range_data(out);
+            std::size_t i = 0;
+
+            for (; i + lanes <= n; i += lanes)
+                detail::simd_store(o + i, static_cast<pack>(f(detail::simd_load<pack>(std::get<I>(set.data) + i)...)));
+
+            for (; i != n; ++i)
+                o[i] = f(std::get<I>(set.data)[i]...);
+
+            return n;
+        }
+    };
+
+    template<typename Callable>
+    inline constexpr auto
+    simd_lift(Callable&& c) {
+        using wrapped = std::decay_t<decltype(detail::fwrap_unless_clbl(std::forward<Callable>(c)))>;
+        return simd_lifted<wrapped>{ detail::fwrap_unless_clbl(std::forward<Callable>(c)) };
+    }
+}
+
+#endif
\ No newline at end of file
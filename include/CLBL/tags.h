@@ -33,6 +33,23 @@ namespace clbl {
     struct ambi_fn_obj_tag {};
     struct fn_obj_ptr_tag {};
     struct ambi_fn_obj_ptr_tag {};
+    struct bound_fn_tag {};
+    struct composed_fn_tag {};
+    struct decorated_fn_tag {};
+
+    /*
+    passing clbl::devirtualize as the first argument to clbl::fwrap binds a
+    virtual member function to the final overrider of the object
+    */
+    struct devirtualize_t {};
+    constexpr devirtualize_t devirtualize{};
+
+    /*
+    passing clbl::parallel as the first argument to clbl::for_each_member splits
+    the range across threads
+    */
+    struct parallel_t {};
+    constexpr parallel_t parallel{};
 }
 
 #endif
\ No newline at end of file
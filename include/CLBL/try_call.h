@@ -26,7 +26,7 @@ namespace clbl {
         template<bool B>
         constexpr call_if_t<B> call_if;
 
-        auto can_call_f = is_valid([](auto&& c, auto&&... args) -> decltype(c(args...)) {});
+        static auto can_call_f = is_valid([](auto&& c, auto&&... args) -> decltype(c(args...)) {});
     }
 
     //todo - std::optional instead of void
@@ -0,0 +1,113 @@
+#ifndef CLBL_UNIQUE_FUNCTION_H
+#define CLBL_UNIQUE_FUNCTION_H
+
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/erased_call.h>
+#include <CLBL/utility.h>
+
+namespace clbl {
+
+    /*
+    clbl::unique_function is a move-only, owning, type-erased callable. Unlike
+    std::function, it does not require its target to be copyable, so a CLBL
+    wrapper holding a move-only object (e.g. a std::unique_ptr) can be converted
+    by passing it as an rvalue:
+
+        auto f = clbl::convert_to<clbl::unique_function>(std::move(wrapper));
+
+    The target is allocated once, at conversion time. Moving a unique_function
+    only transfers that allocation. Calling an empty unique_function is undefined.
+    */
+
+    template<typename BadGlueType>
+    struct unique_function {
+        static_assert(sizeof(BadGlueType) < 0, "Invalid template arguments.");
+    };
+
+    template<typename Return, typename... GlueArgs>
+    struct unique_function<Return(GlueArgs...)> {
+
+        using my_type = unique_function<Return(GlueArgs...)>;
+        using call_type = erased_call<Return, GlueArgs...>;
+
+        inline unique_function()
+            : target{ nullptr }, ops{ nullptr }
+        {}
+
+        template<typename F, std::enable_if_t<
+            !std::is_same<std::decay_t<F>, my_type>::value, dummy>* = nullptr>
+        inline unique_function(F&& f)
+            : target{ new std::decay_t<F>(std::forward<F>(f)) },
+            ops{ &operations_for<std::decay_t<F> >() }
+        {}
+
+        inline unique_function(my_type&& other) noexcept
+            : target{ other.target }, ops{ other.ops } {
+            other.target = nullptr;
+            other.ops = nullptr;
+        }
+
+        unique_function(const my_type&) = delete;
+        my_type& operator=(const my_type&) = delete;
+
+        inline my_type& operator=(my_type&& other) noexcept {
+            if (this != &other) {
+                reset();
+                target = other.target;
+                ops = other.ops;
+                other.target = nullptr;
+                other.ops = nullptr;
+            }
+            return *this;
+        }
+
+        inline ~unique_function() {
+            reset();
+        }
+
+        inline Return operator()(GlueArgs... args) const {
+            return call_type::call(ops->invoke, target, args...);
+        }
+
+        inline explicit operator bool() const {
+            return target != nullptr;
+        }
+
+    private:
+
+        struct operations {
+            typename call_type::thunk_type invoke;
+            void(*destroy)(void*);
+        };
+
+        template<typename F>
+        struct target_operations {
+
+            static inline void destroy(void* t) {
+                delete static_cast<F*>(t);
+            }
+        };
+
+        template<typename F>
+        static inline const operations& operations_for() {
+            static const operations ops = { call_type::template thunk_for<F>(), &target_operations<F>::destroy };
+            return ops;
+        }
+
+        inline void reset() {
+            if (target != nullptr) {
+                ops->destroy(target);
+            }
+            target = nullptr;
+            ops = nullptr;
+        }
+
+        void* target;
+        const operations* ops;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -1,6 +1,10 @@
 #ifndef CLBL_UTILITY_H
 #define CLBL_UTILITY_H
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include <CLBL/tags.h>
 #include <CLBL/qualify_flags.h>
 #include <CLBL/is_valid.h>
@@ -8,8 +12,8 @@
 #define CLBL_CALL_PTR(cv_ignored, ptr, args) (*ptr)(args)
 #define CLBL_UPCAST_AND_CALL_PTR(qual, ptr, args) harden_cast<cv<qual dummy> | cv_flags>(*ptr)(args)
 #define CLBL_UPCAST_AND_CALL_VAL(qual, val, args) harden_cast<cv<qual dummy> | cv_flags>(val)(args)
-#define CLBL_UPCAST_AND_CALL_MEMBER_PTR(qual, optr, member, args)(harden_cast<cv<qual dummy> | cv_flags>(*optr).*member)(args)
-#define CLBL_UPCAST_AND_CALL_MEMBER_VAL(qual, obj, member, args) (harden_cast<cv<qual dummy> | cv_flags>(obj).*member)(args)
+#define CLBL_UPCAST_AND_CALL_MEMBER_PTR(qual, optr, member, args) detail::invoke_member_ptr<cv<qual dummy> | cv_flags | member_object_flags<decltype(member)> >(optr, member, args)
+#define CLBL_UPCAST_AND_CALL_MEMBER_VAL(qual, obj, member, args) detail::invoke_member<cv<qual dummy> | cv_flags | member_object_flags<decltype(member)> >(obj, member, args)
 
 namespace clbl {
 
@@ -20,6 +24,22 @@ namespace clbl {
     template<typename T>
     using no_ref = std::remove_reference_t<T>;
 
+    namespace detail {
+
+        template<typename Return, typename Expression>
+        struct return_if_valid_t {
+            using type = Return;
+        };
+    }
+
+    /*
+    clbl::return_if_valid is Return, as long as Expression (a decltype) can be formed.
+    As the trailing return type of an operator() overload, it removes the overload
+    when the call it makes would be ill-formed
+    */
+    template<typename Return, typename Expression>
+    using return_if_valid = typename detail::return_if_valid_t<Return, Expression>::type;
+
     /*
     clbl::args is a metafunction to extract the arg_types
     alias of a CLBL wrapper
@@ -35,11 +55,11 @@ namespace clbl {
         template <typename T>
         struct is_reference_wrapper_t<std::reference_wrapper<T> > : std::true_type {};
 
-        auto can_dereference_impl = is_valid([](auto arg)->decltype(*arg) {});
+        static auto can_dereference_impl = is_valid([](auto arg)->decltype(*arg) {});
 
         static auto already_has_cv_flags_t = is_valid([](auto c) -> decltype(decltype(c)::cv_flags) {});
 
-        auto has_creator_t = is_valid([](auto arg)-> typename decltype(arg)::creator{});
+        static auto has_creator_t = is_valid([](auto arg)-> typename decltype(arg)::creator{});
     }
 
     template<typename T>
@@ -95,7 +115,7 @@ namespace clbl {
     template<typename FunctionType, typename Callable, std::enable_if_t<is_clbl<no_ref<Callable> >, dummy>* = nullptr>
     static inline constexpr auto
     emulates(Callable&& c) {
-        return std::is_same<no_ref<Callable>::type, FunctionType>::value;
+        return std::is_same<typename no_ref<Callable>::type, FunctionType>::value;
     }
 
     template<typename FunctionType, typename T, std::enable_if_t<!is_clbl<no_ref<T> >, dummy>* = nullptr>
@@ -106,16 +126,59 @@ namespace clbl {
         return false;
     }
 
+    /*
+    clbl::is_volatile_copy_of enables the constructor templates that CLBL types
+    use to copy from a volatile (or const volatile) instance of themselves.
+    A constructor template is never a copy constructor, so unlike user-provided
+    volatile copy constructors, these leave the defaulted copy constructors trivial.
+    */
+    template<typename T, typename Other>
+    constexpr bool is_volatile_copy_of = std::is_volatile<Other>::value
+        && std::is_same<std::remove_cv_t<Other>, T>::value;
+
+    /*
+    clbl::is_trivially_relocatable is true for types that can be moved to
+    a new address with memcpy, leaving nothing to destroy at the old one.
+    CLBL wrappers and their glue are trivially relocatable whenever the
+    objects/pointers they hold are.
+    */
+    template<typename T>
+    constexpr bool is_trivially_relocatable = std::is_trivially_copyable<T>::value
+        && std::is_trivially_destructible<T>::value;
+
     template<typename Callable>
     using forwarding_glue = typename no_ref<Callable>::forwarding_glue;
 
     template<typename Callable>
     using result_of = typename no_ref<Callable>::return_type;
 
+    namespace detail {
+
+        //ambiguous wrappers don't have argument types to check
+        template<typename Callable, typename ArgTypes>
+        struct is_noexcept_t : std::false_type {};
+
+        template<typename Callable, typename... Args>
+        struct is_noexcept_t<Callable, std::tuple<Args...> >
+            : std::integral_constant<bool, noexcept(std::declval<Callable>()(std::declval<Args>()...))> {};
+    }
+
+    /*
+    clbl::is_noexcept is true when calling a CLBL wrapper with its argument types
+    can't throw. The wrappers' operator(), copy_invocation and glue are noexcept
+    whenever the wrapped call is, so this carries over to converted functions too.
+    Before C++17, noexcept isn't part of function types, so a call through a
+    function pointer or a PMF is never noexcept, and neither is any wrapper that
+    has argument types (ambiguous wrappers call the object directly, so their
+    operator() is still noexcept when the object's is).
+    */
+    template<typename Callable>
+    constexpr bool is_noexcept = detail::is_noexcept_t<Callable, args<Callable> >::value;
+
     template<typename ReturnType, typename Callable, std::enable_if_t<is_clbl<no_ref<Callable> >, dummy>*  = nullptr>
     static inline constexpr auto
     returns(Callable&& c) {
-        return std::is_same<no_ref<Callable>::return_type, ReturnType>::value;
+        return std::is_same<typename no_ref<Callable>::return_type, ReturnType>::value;
     }
 
     template<typename ReturnType, typename T, std::enable_if_t<!is_clbl<no_ref<T> >, dummy>* = nullptr>
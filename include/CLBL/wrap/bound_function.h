@@ -0,0 +1,34 @@
+#ifndef CLBL_BOUND_FUNCTION_H
+#define CLBL_BOUND_FUNCTION_H
+
+#include <type_traits>
+
+#include <CLBL/utility.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/invocation_data.h>
+#include <CLBL/wrappers/bound_fn_wrapper.h>
+
+namespace clbl {
+
+    //FunctionType is the signature left after binding (see clbl::bind_front)
+    template<typename FunctionType>
+    struct bound_function {
+
+        template<qualify_flags Flags, typename Callable, typename... BoundArgs>
+        static inline constexpr auto
+        wrap(Callable&& c, BoundArgs&&... args) {
+            using data_type = bound_invocation_data<std::decay_t<Callable>, std::decay_t<BoundArgs>...>;
+            using wrapper = bound_fn_wrapper<bound_function, Flags, data_type, FunctionType>;
+            return wrapper{ data_type{ dummy{}, std::forward<Callable>(c), std::forward<BoundArgs>(args)... } };
+        }
+
+        template<qualify_flags Flags, typename Invocation>
+        static inline constexpr auto
+            wrap_data(Invocation&& data) {
+            using wrapper = bound_fn_wrapper<bound_function, Flags, std::remove_cv_t<no_ref<Invocation> >, FunctionType>;
+            return wrapper{ std::forward<Invocation>(data) };
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef CLBL_COMPOSED_FUNCTION_H
+#define CLBL_COMPOSED_FUNCTION_H
+
+#include <type_traits>
+
+#include <CLBL/utility.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/invocation_data.h>
+#include <CLBL/wrappers/composed_fn_wrapper.h>
+
+namespace clbl {
+
+    //FunctionType is the signature of the whole pipeline (see clbl::compose)
+    template<typename FunctionType>
+    struct composed_function {
+
+        template<qualify_flags Flags, typename... Stages>
+        static inline constexpr auto
+        wrap(Stages&&... stages) {
+            using data_type = composed_invocation_data<std::decay_t<Stages>...>;
+            using wrapper = composed_fn_wrapper<composed_function, Flags, data_type, FunctionType>;
+            return wrapper{ data_type{ dummy{}, std::forward<Stages>(stages)... } };
+        }
+
+        template<qualify_flags Flags, typename Invocation>
+        static inline constexpr auto
+            wrap_data(Invocation&& data) {
+            using wrapper = composed_fn_wrapper<composed_function, Flags, std::remove_cv_t<no_ref<Invocation> >, FunctionType>;
+            return wrapper{ std::forward<Invocation>(data) };
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef CLBL_DECORATED_FUNCTION_H
+#define CLBL_DECORATED_FUNCTION_H
+
+#include <type_traits>
+
+#include <CLBL/utility.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/invocation_data.h>
+#include <CLBL/wrappers/decorated_fn_wrapper.h>
+
+namespace clbl {
+
+    //FunctionType is the signature of the decorated wrapper (see clbl::decorate)
+    template<typename FunctionType>
+    struct decorated_function {
+
+        template<qualify_flags Flags, typename Callable, typename... Advice>
+        static inline constexpr auto
+        wrap(Callable&& c, Advice&&... advice) {
+            using data_type = decorated_invocation_data<std::decay_t<Callable>, std::decay_t<Advice>...>;
+            using wrapper = decorated_fn_wrapper<decorated_function, Flags, data_type, FunctionType>;
+            return wrapper{ data_type{ dummy{}, std::forward<Callable>(c), std::forward<Advice>(advice)... } };
+        }
+
+        template<qualify_flags Flags, typename Invocation>
+        static inline constexpr auto
+            wrap_data(Invocation&& data) {
+            using wrapper = decorated_fn_wrapper<decorated_function, Flags, std::remove_cv_t<no_ref<Invocation> >, FunctionType>;
+            return wrapper{ std::forward<Invocation>(data) };
+        }
+    };
+}
+
+#endif
\ No newline at end of file
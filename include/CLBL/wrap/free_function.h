@@ -12,8 +12,9 @@ namespace clbl {
         template<qualify_flags Flags, typename T>
         static inline constexpr auto
         wrap(T&& t) {
-            using function_type = std::remove_pointer_t<no_ref<T> >;
-            using wrapper = free_fn_wrapper<free_function, function_type>;
+            using fn_ptr_type = std::add_pointer_t<std::remove_pointer_t<no_ref<T> > >;
+            using function_type = function_decay<std::remove_pointer_t<fn_ptr_type> >;
+            using wrapper = free_fn_wrapper<free_function, fn_ptr_type, function_type>;
             return wrapper{ std::forward<T>(t) };
         }
 
@@ -0,0 +1,32 @@
+#ifndef CLBL_FREE_FUNCTION_SLIM_H
+#define CLBL_FREE_FUNCTION_SLIM_H
+
+#include <type_traits>
+
+#include <CLBL/member_function_decay.h>
+#include <CLBL/utility.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/wrappers/free_fn_wrapper_slim.h>
+
+namespace clbl {
+
+    //"slim" means it takes the function pointer as a template argument
+    struct free_function_slim {
+
+        template<qualify_flags Flags, typename TFnPtr, TFnPtr FnPtr>
+        static inline constexpr auto
+        wrap() {
+            using function_type = function_decay<std::remove_pointer_t<TFnPtr> >;
+            using wrapper = free_fn_wrapper_slim<free_function_slim, TFnPtr, FnPtr, function_type>;
+            return wrapper{};
+        }
+
+        template<qualify_flags Flags, typename TFnPtr, TFnPtr FnPtr>
+        static inline constexpr auto
+            wrap_data(const ptr_invocation_data_slim<TFnPtr, FnPtr>&) {
+            return wrap<Flags, TFnPtr, FnPtr>();
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -24,7 +24,7 @@ namespace clbl {
         template<qualify_flags Flags, typename Invocation>
         static inline constexpr auto
             wrap_data(Invocation&& data) {
-            return wrap<Flags>(data.pmf, data.object);
+            return wrap<Flags>(data.pmf, std::forward<Invocation>(data).object);
         }
     };
 }
@@ -25,7 +25,7 @@ namespace clbl {
         template<qualify_flags Flags, typename Invocation>
         static inline constexpr auto
             wrap_data(Invocation&& data) {
-            return wrap<Flags, decltype(no_ref<Invocation>::pmf), no_ref<Invocation>::pmf>(data.object);
+            return wrap<Flags, decltype(no_ref<Invocation>::pmf), no_ref<Invocation>::pmf>(std::forward<Invocation>(data).object);
         }
     };
 }
@@ -11,6 +11,8 @@ namespace clbl {
 
     struct member_function_with_pointer_to_object {
 
+        static constexpr bool devirtualizes = false;
+
         template<qualify_flags Flags = qflags::default_, typename T, typename TMemberFnPtr>
         static inline constexpr auto
         wrap(TMemberFnPtr member_fn_ptr, T&& t) {
@@ -25,9 +27,59 @@ namespace clbl {
 
         template<qualify_flags Flags = qflags::default_, typename Invocation>
         static inline constexpr auto
-            wrap_data(Invocation&& data) {
-            return wrap<Flags>(data.pmf, data.object_ptr);
+            wrap_data(Invocation&& data) -> decltype(wrap<Flags>(member_fn_ptr_of(data), std::forward<Invocation>(data).object_ptr)) {
+            return wrap<Flags>(member_fn_ptr_of(data), std::forward<Invocation>(data).object_ptr);
+        }
+
+        //compressed data is reused, since its object_ptr is already adjusted for the PMF
+        template<qualify_flags Flags = qflags::default_, typename T, typename TMemberFnPtr, typename FunctionType>
+        static inline constexpr auto
+            wrap_data(compressed_pmf_invocation_data<T*, TMemberFnPtr, FunctionType> data) {
+            constexpr auto cv_qualifiers = cv<T*> | Flags;
+            using decayed_fn = member_function_decay<TMemberFnPtr>;
+            using wrapper = pmf_ptr_wrapper<member_function_with_pointer_to_object,
+                                cv_qualifiers, T, T*, TMemberFnPtr, decayed_fn>;
+            return wrapper{ data };
         }
+
+        /*
+        devirtualized resolves a virtual member function to the final overrider of
+        the object it is bound to. Falls back to the ordinary wrapper for smart
+        pointers, or when CLBL_COMPACT_PMF is 0.
+        */
+        struct devirtualized {
+
+            static constexpr bool devirtualizes = true;
+
+            template<qualify_flags Flags = qflags::default_, typename T, typename TMemberFnPtr>
+            static inline constexpr auto
+            wrap(TMemberFnPtr member_fn_ptr, T&& t) {
+                constexpr auto cv_qualifiers = cv<T> | Flags;
+                using object_type = no_ref<decltype(*std::declval<T>())>;
+                using ptr_type = no_ref<T>;
+                using decayed_fn = member_function_decay<TMemberFnPtr>;
+                using wrapper = pmf_ptr_wrapper<member_function_with_pointer_to_object::devirtualized,
+                                    cv_qualifiers, object_type, ptr_type, TMemberFnPtr, decayed_fn>;
+                return wrapper{ member_fn_ptr, std::forward<T>(t) };
+            }
+
+            template<qualify_flags Flags = qflags::default_, typename Invocation>
+            static inline constexpr auto
+                wrap_data(Invocation&& data) -> decltype(wrap<Flags>(member_fn_ptr_of(data), std::forward<Invocation>(data).object_ptr)) {
+                return wrap<Flags>(member_fn_ptr_of(data), std::forward<Invocation>(data).object_ptr);
+            }
+
+            //the resolved function is reused, since it can't be turned back into a PMF
+            template<qualify_flags Flags = qflags::default_, typename T, typename TMemberFnPtr, typename FunctionType>
+            static inline constexpr auto
+                wrap_data(devirtualized_pmf_invocation_data<T*, TMemberFnPtr, FunctionType> data) {
+                constexpr auto cv_qualifiers = cv<T*> | Flags;
+                using decayed_fn = member_function_decay<TMemberFnPtr>;
+                using wrapper = pmf_ptr_wrapper<member_function_with_pointer_to_object::devirtualized,
+                                    cv_qualifiers, T, T*, TMemberFnPtr, decayed_fn>;
+                return wrapper{ data };
+            }
+        };
     };
 
 }
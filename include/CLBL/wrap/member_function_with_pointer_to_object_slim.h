@@ -27,7 +27,7 @@ namespace clbl {
         template<qualify_flags Flags = qflags::default_, typename Invocation, typename TMemberFnPtr = decltype(Invocation::pmf), TMemberFnPtr Pmf = Invocation::pmf>
         static inline constexpr auto
             wrap_data(Invocation&& data) {
-            return wrap<Flags, TMemberFnPtr, Pmf>(data.object_ptr);
+            return wrap<Flags, TMemberFnPtr, Pmf>(std::forward<Invocation>(data).object_ptr);
         }
     };
 }
@@ -29,7 +29,7 @@ namespace clbl {
         template<qualify_flags Flags, typename Invocation>
         static inline constexpr auto
             wrap_data(Invocation&& data) {
-            return wrap<Flags>(data.object_ptr);
+            return wrap<Flags>(std::forward<Invocation>(data).object_ptr);
         }
 
         struct ambiguous {
@@ -46,7 +46,7 @@ namespace clbl {
             template<qualify_flags Flags, typename Invocation>
             static inline constexpr auto
                 wrap_data(Invocation&& data) {
-                return wrap<Flags>(data.ptr);
+                return wrap<Flags>(std::forward<Invocation>(data).ptr);
             }
         };
 
@@ -75,7 +75,7 @@ namespace clbl {
                 whatsoever on const-correctness
                 */
                 using pmf_type = std::remove_const_t<decltype(no_ref<Invocation>::pmf)>;
-                return wrap<Flags, pmf_type>(data.object_ptr);
+                return wrap<Flags, pmf_type>(std::forward<Invocation>(data).object_ptr);
             }
         };
     };
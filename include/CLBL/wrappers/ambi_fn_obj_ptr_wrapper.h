@@ -40,15 +40,15 @@ namespace clbl {
 
         invocation_data_type data;
 
-        inline ambi_fn_obj_ptr_wrapper(std::remove_const_t<TPtr>& o_ptr)
+        inline constexpr ambi_fn_obj_ptr_wrapper(std::remove_const_t<TPtr>& o_ptr)
             : data{ o_ptr }
         {}
 
-        inline ambi_fn_obj_ptr_wrapper(const TPtr& o_ptr)
+        inline constexpr ambi_fn_obj_ptr_wrapper(const TPtr& o_ptr)
             : data{ o_ptr }
         {}
 
-        inline ambi_fn_obj_ptr_wrapper(TPtr&& o_ptr)
+        inline constexpr ambi_fn_obj_ptr_wrapper(TPtr&& o_ptr)
             : data{ std::forward<TPtr>(o_ptr) }
         {}
 
@@ -56,54 +56,67 @@ namespace clbl {
         inline ambi_fn_obj_ptr_wrapper(const my_type& other) = default;
         inline ambi_fn_obj_ptr_wrapper(my_type&& other) = default;
       
-        inline ambi_fn_obj_ptr_wrapper(volatile my_type& other)
-            : data(other.data)
-        {}
-
-        inline ambi_fn_obj_ptr_wrapper(const volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr ambi_fn_obj_ptr_wrapper(Other& other)
             : data(other.data)
         {}
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) {
+        inline constexpr decltype(auto) operator()(Fargs&&... a)
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_PTR(__CLBL_NO_CV, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_PTR(__CLBL_NO_CV, data.ptr, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) const {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_PTR(const, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_PTR(const, data.ptr, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) volatile {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_PTR(volatile, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_PTR(volatile, data.ptr, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) const volatile {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_PTR(const volatile, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_PTR(const volatile, data.ptr, std::forward<Fargs>(a)...);
         }
 
         static inline constexpr auto copy_invocation(my_type& c) {
-            return[v = c.data.ptr](auto&&... args){ 
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_PTR(__CLBL_NO_CV, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(my_type&& c) {
+            return[v = std::move(c.data.ptr)](auto&&... args)
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_PTR(__CLBL_NO_CV, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(const my_type& c) {
-            return[v = c.data.ptr](auto&&... args){ 
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_PTR(const, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(volatile my_type& c) {
-            return[v = c.data.ptr](auto&&... args){ 
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_PTR(volatile, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(const volatile my_type& c) {
-            return[v = c.data.ptr](auto&&... args){ 
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_PTR(const volatile, v, args...);
             };
         }
@@ -40,65 +40,103 @@ namespace clbl {
 
         invocation_data_type data;
 
-        inline ambi_fn_obj_wrapper(const std::remove_const_t<T>& o)
+        inline constexpr ambi_fn_obj_wrapper(const std::remove_const_t<T>& o)
             : data{ o }
         {}
 
-        inline ambi_fn_obj_wrapper(std::remove_const_t<T>&& o)
-            : data{ o }
+        inline constexpr ambi_fn_obj_wrapper(std::remove_const_t<T>&& o)
+            : data{ std::move(o) }
         {}
 
         inline ambi_fn_obj_wrapper(my_type& other) = default;
         inline ambi_fn_obj_wrapper(const my_type& other) = default;
+        inline ambi_fn_obj_wrapper(my_type&& other) = default;
 
-        inline ambi_fn_obj_wrapper(volatile my_type& other)
-            : data{ other.data }
-        {}
-
-        inline ambi_fn_obj_wrapper(const volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr ambi_fn_obj_wrapper(Other& other)
             : data{ other.data }
         {}
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(__CLBL_NO_CV, data.object, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_VAL(__CLBL_NO_CV, data.object, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) const {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(const, data.object, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_VAL(const, data.object, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) volatile {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(volatile, data.object, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_VAL(volatile, data.object, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline auto operator()(Fargs&&... a) const volatile {
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(const volatile, data.object, std::forward<Fargs>(a)...))) {
             return CLBL_UPCAST_AND_CALL_VAL(const volatile, data.object, std::forward<Fargs>(a)...);
         }
 
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(__CLBL_NO_CV, std::move(data.object), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_VAL(__CLBL_NO_CV, std::move(data.object), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(const, std::move(data.object), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_VAL(const, std::move(data.object), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(volatile, std::move(data.object), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_VAL(volatile, std::move(data.object), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_VAL(const volatile, std::move(data.object), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_VAL(const volatile, std::move(data.object), std::forward<Fargs>(a)...);
+        }
+
         static inline constexpr auto copy_invocation(my_type& c) {
-            return [v = c.data.object](auto&&... args) mutable {
+            return [v = c.data.object](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_VAL(__CLBL_NO_CV, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(my_type&& c) {
+            return [v = std::move(c.data.object)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_VAL(__CLBL_NO_CV, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(const my_type& c) {
-            return [v = c.data.object](auto&&... args){
+            return [v = c.data.object](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_VAL(const, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(volatile my_type& c) {
-            return [v = c.data.object](auto&&... args) mutable {
+            return [v = c.data.object](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_VAL(volatile, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(const volatile my_type& c) {
-            return [v = c.data.object](auto&&... args){
+            return [v = c.data.object](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_VAL(const volatile, v, args...);
             };
         }
@@ -0,0 +1,181 @@
+#ifndef CLBL_BOUND_FN_WRAPPER_H
+#define CLBL_BOUND_FN_WRAPPER_H
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/utility.h>
+#include <CLBL/forward.h>
+#include <CLBL/harden_cast.h>
+#include <CLBL/invocation_macros.h>
+#include <CLBL/invocation_data.h>
+
+namespace clbl {
+
+    /*
+    bound_fn_wrapper wraps a CLBL wrapper together with the arguments bound to
+    the front of its parameter list (see clbl::bind_front). FunctionType is the
+    remaining signature, or ambiguous_return(ambiguous_args) until clbl::harden
+    is called on an ambiguous wrapper.
+
+    The wrapper and the bound arguments are called with the CV flags of the
+    bound_fn_wrapper. An rvalue bound_fn_wrapper passes them as rvalues, so
+    bound arguments can be moved into the call.
+    */
+    template<typename Creator, qualify_flags CvFlags, typename Data, typename FunctionType>
+    struct bound_fn_wrapper { static_assert(sizeof(FunctionType) < 0, "Not a function type."); };
+
+    template<typename Creator, qualify_flags CvFlags, typename Data, typename Return, typename... Args>
+    struct bound_fn_wrapper<Creator, CvFlags, Data, Return(Args...)> {
+
+        static constexpr auto is_ambiguous = std::is_same<Return(Args...), ambiguous_return(ambiguous_args)>::value;
+
+        using arg_types = std::conditional_t<is_ambiguous, ambiguous_args, std::tuple<Args...> >;
+        using clbl_tag = bound_fn_tag;
+        using creator = Creator;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = Data;
+        using my_type = bound_fn_wrapper<Creator, CvFlags, Data, Return(Args...)>;
+        using return_type = Return;
+        using type = Return(Args...);
+        using underlying_type = my_type;
+
+        template<qualify_flags Flags>
+        using apply_cv = bound_fn_wrapper<Creator, CvFlags | Flags, Data, Return(Args...)>;
+
+        static constexpr auto cv_flags = CvFlags;
+
+        invocation_data_type data;
+
+        inline constexpr bound_fn_wrapper(const invocation_data_type& d)
+            : data{ d }
+        {}
+
+        inline constexpr bound_fn_wrapper(invocation_data_type&& d)
+            : data{ std::move(d) }
+        {}
+
+        inline bound_fn_wrapper(my_type& other) = default;
+        inline bound_fn_wrapper(const my_type& other) = default;
+        inline bound_fn_wrapper(my_type&& other) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr bound_fn_wrapper(Other& other)
+            : data{ other.data }
+        {}
+
+        //calls the wrapper with the bound arguments, then the arguments of the call
+        template<qualify_flags Flags, typename D, std::size_t... I, typename... Fargs>
+        static inline constexpr auto
+        invoke_bound(D&& d, std::index_sequence<I...>, Fargs&&... a)
+            noexcept(noexcept(harden_cast<Flags>(bound_get<0>(std::forward<D>(d)))(
+                harden_cast<Flags>(bound_get<I + 1>(std::forward<D>(d)))..., std::forward<Fargs>(a)...)))
+            -> std::conditional_t<is_ambiguous,
+                decltype(harden_cast<Flags>(bound_get<0>(std::forward<D>(d)))(
+                    harden_cast<Flags>(bound_get<I + 1>(std::forward<D>(d)))..., std::forward<Fargs>(a)...)),
+                Return> {
+            return harden_cast<Flags>(bound_get<0>(std::forward<D>(d)))(
+                harden_cast<Flags>(bound_get<I + 1>(std::forward<D>(d)))..., std::forward<Fargs>(a)...);
+        }
+
+        template<qualify_flags Flags, typename D, typename... Fargs>
+        static inline constexpr auto
+        invoke_data(D&& d, Fargs&&... a)
+            noexcept(noexcept(invoke_bound<Flags>(std::forward<D>(d),
+                typename no_ref<D>::bound_indices{}, std::forward<Fargs>(a)...)))
+            -> decltype(invoke_bound<Flags>(std::forward<D>(d),
+                typename no_ref<D>::bound_indices{}, std::forward<Fargs>(a)...)) {
+            return invoke_bound<Flags>(std::forward<D>(d),
+                typename no_ref<D>::bound_indices{}, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        static inline constexpr auto copy_invocation(my_type& c) {
+            return [v = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(my_type&& c) {
+            return [v = std::move(c.data)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(const my_type& c) {
+            return [v = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(volatile my_type& c) {
+            return [v = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(const volatile my_type& c) {
+            return [v = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, v, args...);
+            };
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -14,7 +14,9 @@ namespace clbl {
 
     /*
     casted_fn_obj_wrapper wraps a pointer to an ambiguous callable 
-    object, but uses a static_cast on operator() to disambiguate it.
+    object, but uses a static_cast on operator() to disambiguate it. Overloads
+    of operator() with qualifiers that the casted operator() can't be called
+    with don't take part in overload resolution.
     */
     template<typename, qualify_flags, typename, typename, 
         typename TMemberFnPtr, typename DispatchFailureCase>
@@ -30,7 +32,7 @@ namespace clbl {
         using arg_types = std::tuple<Args...>;
         using clbl_tag = pmf_ptr_tag;
         using creator = Creator;
-        using forwarding_glue = Return(forward<Args>...);
+        using forwarding_glue = Return(glue_arg<Args>...);
         using invocation_data_type = object_pointer_casted_invocation_data<TPtr, UnderlyingType, TMemberFnPtr>;
         using my_type = casted_fn_obj_ptr_wrapper<Creator, CvFlags, UnderlyingType, TPtr, TMemberFnPtr, decayed_member_fn_ptr>;
         using return_type = Return;
@@ -48,11 +50,11 @@ namespace clbl {
         casted_fn_obj_ptr_wrapper()
         {}
 
-        casted_fn_obj_ptr_wrapper(TPtr&& o_ptr)
+        inline constexpr casted_fn_obj_ptr_wrapper(TPtr&& o_ptr)
             : data{ std::forward<TPtr>(o_ptr) }
         {}
 
-        inline casted_fn_obj_ptr_wrapper(TPtr& o_ptr)
+        inline constexpr casted_fn_obj_ptr_wrapper(TPtr& o_ptr)
             : data{ o_ptr }
         {}
 
@@ -61,25 +63,33 @@ namespace clbl {
         inline casted_fn_obj_ptr_wrapper(my_type&& other) = default;
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) {
+        inline constexpr auto operator()(Fargs&&... a)
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV, 
                 data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const {
+        inline constexpr auto operator()(Fargs&&... a) const
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_PTR(const, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_PTR(const, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const, 
                 data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) volatile {
+        inline constexpr auto operator()(Fargs&&... a) volatile
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_PTR(volatile, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_PTR(volatile, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_PTR(volatile, 
                 data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const volatile {
+        inline constexpr auto operator()(Fargs&&... a) const volatile
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_PTR(const volatile, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_PTR(const volatile, data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const volatile, 
                 data.object_ptr, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
@@ -114,7 +124,17 @@ namespace clbl {
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV, 
+                    d.object_ptr, decltype(d)::pmf, args...);
+            };
+        }
+
+        template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        static inline constexpr auto copy_invocation(my_type&& c) {
+            return[d = std::move(c.data)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV, 
                     d.object_ptr, decltype(d)::pmf, args...);
             };
@@ -122,7 +142,8 @@ namespace clbl {
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(const my_type& c) {
-            return[d = c.data](auto&&... args){
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const, 
                     d.object_ptr, decltype(d)::pmf, args...);
             };
@@ -130,7 +151,8 @@ namespace clbl {
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(volatile my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_PTR(volatile,
                     d.object_ptr, decltype(d)::pmf, args...);
             };
@@ -138,7 +160,8 @@ namespace clbl {
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(const volatile my_type& c) {
-            return[d = c.data](auto&&... args){
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const volatile,
                     d.object_ptr, decltype(d)::pmf, args...);
             };
@@ -0,0 +1,229 @@
+#ifndef CLBL_COMPOSED_FN_WRAPPER_H
+#define CLBL_COMPOSED_FN_WRAPPER_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <CLBL/tags.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/utility.h>
+#include <CLBL/forward.h>
+#include <CLBL/harden_cast.h>
+#include <CLBL/invocation_macros.h>
+#include <CLBL/invocation_data.h>
+
+namespace clbl {
+
+    namespace detail {
+
+        /*
+        composed_stage_result<Flags, D, I, std::tuple<Args...> > is the result of
+        stage I of the pipeline in D, when the first stage is called with Args.
+        It has no members when some stage can't be called with the result of the
+        stage before it.
+        */
+        template<qualify_flags Flags, typename D, typename ArgsTuple, typename = void>
+        struct composed_first_stage {};
+
+        template<qualify_flags Flags, typename D, typename... Args>
+        struct composed_first_stage<Flags, D, std::tuple<Args...>,
+            decltype(void(harden_cast<Flags>(bound_get<0>(std::declval<D>()))(std::declval<Args>()...)))> {
+
+            using type = decltype(harden_cast<Flags>(bound_get<0>(std::declval<D>()))(std::declval<Args>()...));
+
+            static constexpr bool is_nothrow =
+                noexcept(harden_cast<Flags>(bound_get<0>(std::declval<D>()))(std::declval<Args>()...));
+        };
+
+        template<qualify_flags Flags, typename D, std::size_t I, typename Previous, typename = void>
+        struct composed_next_stage {};
+
+        template<qualify_flags Flags, typename D, std::size_t I, typename Previous>
+        struct composed_next_stage<Flags, D, I, Previous,
+            decltype(void(harden_cast<Flags>(bound_get<I>(std::declval<D>()))(std::declval<typename Previous::type>())))> {
+
+            using type = decltype(harden_cast<Flags>(bound_get<I>(std::declval<D>()))(std::declval<typename Previous::type>()));
+
+            static constexpr bool is_nothrow = Previous::is_nothrow
+                && noexcept(harden_cast<Flags>(bound_get<I>(std::declval<D>()))(std::declval<typename Previous::type>()));
+        };
+
+        template<qualify_flags Flags, typename D, std::size_t I, typename ArgsTuple>
+        struct composed_stage_result
+            : composed_next_stage<Flags, D, I, composed_stage_result<Flags, D, I - 1, ArgsTuple> > {};
+
+        template<qualify_flags Flags, typename D, typename ArgsTuple>
+        struct composed_stage_result<Flags, D, 0, ArgsTuple>
+            : composed_first_stage<Flags, D, ArgsTuple> {};
+    }
+
+    /*
+    composed_fn_wrapper wraps the stages of a clbl::compose pipeline. FunctionType
+    is the signature of the whole pipeline - the parameters of the first stage and
+    the result of the last - or ambiguous_return(ambiguous_args) until clbl::harden
+    is called on a pipeline whose first stage is ambiguous.
+
+    Every stage is called with the CV flags of the composed_fn_wrapper. The calls
+    are nested in one expression, so each intermediate result is a prvalue passed
+    straight into the next stage, and is never stored in the wrapper.
+    */
+    template<typename Creator, qualify_flags CvFlags, typename Data, typename FunctionType>
+    struct composed_fn_wrapper { static_assert(sizeof(FunctionType) < 0, "Not a function type."); };
+
+    template<typename Creator, qualify_flags CvFlags, typename Data, typename Return, typename... Args>
+    struct composed_fn_wrapper<Creator, CvFlags, Data, Return(Args...)> {
+
+        static constexpr auto is_ambiguous = std::is_same<Return(Args...), ambiguous_return(ambiguous_args)>::value;
+
+        using arg_types = std::conditional_t<is_ambiguous, ambiguous_args, std::tuple<Args...> >;
+        using clbl_tag = composed_fn_tag;
+        using creator = Creator;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = Data;
+        using my_type = composed_fn_wrapper<Creator, CvFlags, Data, Return(Args...)>;
+        using return_type = Return;
+        using type = Return(Args...);
+        using underlying_type = my_type;
+
+        template<qualify_flags Flags>
+        using apply_cv = composed_fn_wrapper<Creator, CvFlags | Flags, Data, Return(Args...)>;
+
+        static constexpr auto cv_flags = CvFlags;
+
+        invocation_data_type data;
+
+        inline constexpr composed_fn_wrapper(const invocation_data_type& d)
+            : data{ d }
+        {}
+
+        inline constexpr composed_fn_wrapper(invocation_data_type&& d)
+            : data{ std::move(d) }
+        {}
+
+        inline composed_fn_wrapper(my_type& other) = default;
+        inline composed_fn_wrapper(const my_type& other) = default;
+        inline composed_fn_wrapper(my_type&& other) = default;
+
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr composed_fn_wrapper(Other& other)
+            : data{ other.data }
+        {}
+
+        //the first stage is called with the arguments of the call
+        template<qualify_flags Flags, typename D, typename... Fargs>
+        static inline constexpr typename detail::composed_stage_result<Flags, D, 0, std::tuple<Fargs&&...> >::type
+        call_stage(std::integral_constant<std::size_t, 0>, D&& d, Fargs&&... a)
+            noexcept(detail::composed_stage_result<Flags, D, 0, std::tuple<Fargs&&...> >::is_nothrow) {
+            return harden_cast<Flags>(bound_get<0>(std::forward<D>(d)))(std::forward<Fargs>(a)...);
+        }
+
+        //every other stage is called with the result of the stage before it
+        template<qualify_flags Flags, std::size_t I, typename D, typename... Fargs>
+        static inline constexpr typename detail::composed_stage_result<Flags, D, I, std::tuple<Fargs&&...> >::type
+        call_stage(std::integral_constant<std::size_t, I>, D&& d, Fargs&&... a)
+            noexcept(detail::composed_stage_result<Flags, D, I, std::tuple<Fargs&&...> >::is_nothrow) {
+            return harden_cast<Flags>(bound_get<I>(std::forward<D>(d)))(
+                call_stage<Flags>(std::integral_constant<std::size_t, I - 1>{}, std::forward<D>(d), std::forward<Fargs>(a)...));
+        }
+
+        template<qualify_flags Flags, typename D, typename... Fargs>
+        static inline constexpr auto
+        invoke_data(D&& d, Fargs&&... a)
+            noexcept(noexcept(call_stage<Flags>(std::integral_constant<std::size_t, no_ref<D>::stage_count - 1>{},
+                std::forward<D>(d), std::forward<Fargs>(a)...)))
+            -> std::conditional_t<is_ambiguous,
+                decltype(call_stage<Flags>(std::integral_constant<std::size_t, no_ref<D>::stage_count - 1>{},
+                    std::forward<D>(d), std::forward<Fargs>(a)...)),
+                Return> {
+            return call_stage<Flags>(std::integral_constant<std::size_t, no_ref<D>::stage_count - 1>{},
+                std::forward<D>(d), std::forward<Fargs>(a)...);
+        }
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, data, std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, data, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr decltype(auto) operator()(Fargs&&... a) const volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, std::move(data), std::forward<Fargs>(a)...))) {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, std::move(data), std::forward<Fargs>(a)...);
+        }
+
+        static inline constexpr auto copy_invocation(my_type& c) {
+            return [v = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(my_type&& c) {
+            return [v = std::move(c.data)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(const my_type& c) {
+            return [v = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(volatile my_type& c) {
+            return [v = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, v, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(const volatile my_type& c) {
+            return [v = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, v, args...);
+            };
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -14,20 +14,21 @@
 namespace clbl {
 
     /*
-    free_fn_wrapper wraps a free function
+    free_fn_wrapper wraps a free function. TFnPtr is the type of the stored
+    pointer, which may be a pointer to a noexcept function (since C++17)
     */
-    template<typename, typename Failure>
+    template<typename, typename TFnPtr, typename Failure>
     struct free_fn_wrapper { static_assert(sizeof(Failure) < 0, "Not a function."); };
 
-    template<typename Creator, typename Return, typename... Args>
-    struct free_fn_wrapper<Creator, Return(Args...)> {
+    template<typename Creator, typename TFnPtr, typename Return, typename... Args>
+    struct free_fn_wrapper<Creator, TFnPtr, Return(Args...)> {
 
         using arg_types = std::tuple<Args...>;
         using clbl_tag = free_fn_tag;
         using creator = Creator;
-        using forwarding_glue = Return(forward<Args>...);
-        using invocation_data_type = ptr_invocation_data<Return(*)(Args...)>;
-        using my_type = free_fn_wrapper<Creator, Return(Args...)>;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = ptr_invocation_data<TFnPtr>;
+        using my_type = free_fn_wrapper<Creator, TFnPtr, Return(Args...)>;
         using return_type = Return;
         using type = Return(Args...);
         using underlying_type = my_type;
@@ -40,50 +41,65 @@ namespace clbl {
 
         invocation_data_type data;
 
-        free_fn_wrapper(Return(*f_ptr)(Args...), dummy d = dummy{})
+        inline constexpr free_fn_wrapper(TFnPtr f_ptr, dummy d = dummy{})
             : data{ f_ptr }
         {}
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) { 
+        inline constexpr Return operator()(Fargs&&... a)
+            noexcept(noexcept((*data.ptr)(std::forward<Fargs>(a)...))) {
             return (*data.ptr)(std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const {
+        inline constexpr Return operator()(Fargs&&... a) const
+            noexcept(noexcept(CLBL_CALL_PTR(const, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_CALL_PTR(const, data.ptr, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) volatile {
+        inline constexpr Return operator()(Fargs&&... a) volatile
+            noexcept(noexcept(CLBL_CALL_PTR(volatile, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_CALL_PTR(volatile, data.ptr, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const volatile {
+        inline constexpr Return operator()(Fargs&&... a) const volatile
+            noexcept(noexcept(CLBL_CALL_PTR(const volatile, data.ptr, std::forward<Fargs>(a)...))) {
             return CLBL_CALL_PTR(const volatile, data.ptr, std::forward<Fargs>(a)...);
         }
 
         static inline constexpr auto copy_invocation(my_type& c) {
-            return[&v = c.data.ptr](auto&&... args){
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return (*v)(args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(my_type&& c) {
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
                 return (*v)(args...);
             };
         }
 
         static inline constexpr auto copy_invocation(const my_type& c) {
-            return[v = c.data.ptr](auto&&... args){
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_CALL_PTR(const, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(volatile my_type& c) {
-            return[v = c.data.ptr](auto&&... args){
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_CALL_PTR(volatile, v, args...);
             };
         }
 
         static inline constexpr auto copy_invocation(const volatile my_type& c) {
-            return[v = c.data.ptr](auto&&... args){
+            return[v = c.data.ptr](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_CALL_PTR(const volatile, v, args...);
             };
         }
@@ -0,0 +1,111 @@
+#ifndef CLBL_FREE_FN_WRAPPER_SLIM_H
+#define CLBL_FREE_FN_WRAPPER_SLIM_H
+
+#include <tuple>
+
+#include <CLBL/utility.h>
+#include <CLBL/tags.h>
+#include <CLBL/qualify_flags.h>
+#include <CLBL/forward.h>
+#include <CLBL/harden_cast.h>
+#include <CLBL/invocation_macros.h>
+#include <CLBL/invocation_data.h>
+
+namespace clbl {
+
+    /*
+    free_fn_wrapper_slim wraps a free function. It is identical to free_fn_wrapper
+    except that the function pointer is passed as a template arg instead of being
+    stored, so the wrapper is an empty class and every call is direct.
+    */
+    template<typename, typename TFnPtr, TFnPtr, typename Failure>
+    struct free_fn_wrapper_slim { static_assert(sizeof(Failure) < 0, "Not a function."); };
+
+    template<typename Creator, typename TFnPtr, TFnPtr FnPtr, typename Return, typename... Args>
+    struct free_fn_wrapper_slim<Creator, TFnPtr, FnPtr, Return(Args...)> {
+
+        using arg_types = std::tuple<Args...>;
+        using clbl_tag = free_fn_tag;
+        using creator = Creator;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = ptr_invocation_data_slim<TFnPtr, FnPtr>;
+        using my_type = free_fn_wrapper_slim<Creator, TFnPtr, FnPtr, Return(Args...)>;
+        using return_type = Return;
+        using type = Return(Args...);
+        using underlying_type = my_type;
+
+        template<qualify_flags>
+        using apply_cv = my_type;
+
+        static constexpr auto cv_flags = qflags::default_;
+        static constexpr auto is_ambiguous = false;
+
+        //static, so that the wrapper stays empty
+        static constexpr invocation_data_type data{};
+
+        template<typename... Fargs>
+        inline constexpr Return operator()(Fargs&&... a)
+            noexcept(noexcept((*FnPtr)(std::forward<Fargs>(a)...))) {
+            return (*FnPtr)(std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr Return operator()(Fargs&&... a) const
+            noexcept(noexcept(CLBL_CALL_PTR(const, FnPtr, std::forward<Fargs>(a)...))) {
+            return CLBL_CALL_PTR(const, FnPtr, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr Return operator()(Fargs&&... a) volatile
+            noexcept(noexcept(CLBL_CALL_PTR(volatile, FnPtr, std::forward<Fargs>(a)...))) {
+            return CLBL_CALL_PTR(volatile, FnPtr, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr Return operator()(Fargs&&... a) const volatile
+            noexcept(noexcept(CLBL_CALL_PTR(const volatile, FnPtr, std::forward<Fargs>(a)...))) {
+            return CLBL_CALL_PTR(const volatile, FnPtr, std::forward<Fargs>(a)...);
+        }
+
+        static inline constexpr auto copy_invocation(my_type&) {
+            return[](auto&&... args)
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return (*FnPtr)(args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(my_type&&) {
+            return[](auto&&... args)
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return (*FnPtr)(args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(const my_type&) {
+            return[](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_CALL_PTR(const, FnPtr, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(volatile my_type&) {
+            return[](auto&&... args)
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_CALL_PTR(volatile, FnPtr, args...);
+            };
+        }
+
+        static inline constexpr auto copy_invocation(const volatile my_type&) {
+            return[](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_CALL_PTR(const volatile, FnPtr, args...);
+            };
+        }
+    };
+
+    template<typename Creator, typename TFnPtr, TFnPtr FnPtr, typename Return, typename... Args>
+    constexpr typename free_fn_wrapper_slim<Creator, TFnPtr, FnPtr, Return(Args...)>::invocation_data_type
+        free_fn_wrapper_slim<Creator, TFnPtr, FnPtr, Return(Args...)>::data;
+}
+
+#endif
\ No newline at end of file
@@ -14,7 +14,9 @@ namespace clbl {
 
     /*
     pmf_ptr_wrapper wraps a PMF and a pointer to an object with
-    which to call it.
+    which to call it. When Creator::devirtualizes is true, virtual
+    member functions are resolved on construction. The pointed-to object
+    is always an lvalue, so a &&-qualified PMF can't be called through it.
     */
 
     template<typename, qualify_flags, typename, typename, typename, typename DispatchFailureCase>
@@ -28,8 +30,15 @@ namespace clbl {
         using arg_types = std::tuple<Args...>;
         using clbl_tag = pmf_ptr_tag;
         using creator = Creator;
-        using forwarding_glue = Return(forward<Args>...);
-        using invocation_data_type = indirect_pmf_invocation_data<TPtr, TMemberFnPtr>;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = std::conditional_t<
+            CLBL_COMPACT_PMF && std::is_pointer<TPtr>::value && !is_clbl<UnderlyingType>,
+            std::conditional_t<Creator::devirtualizes,
+                devirtualized_pmf_invocation_data<TPtr, TMemberFnPtr, Return(Args...)>,
+                std::conditional_t<std::is_polymorphic<UnderlyingType>::value,
+                    indirect_pmf_invocation_data<TPtr, TMemberFnPtr>,
+                    compressed_pmf_invocation_data<TPtr, TMemberFnPtr, Return(Args...)> > >,
+            indirect_pmf_invocation_data<TPtr, TMemberFnPtr> >;
         using my_type = pmf_ptr_wrapper<Creator, CvFlags, UnderlyingType, TPtr, TMemberFnPtr, decayed_member_fn_ptr>;
         using return_type = Return;
         using type = Return(Args...);
@@ -46,40 +55,71 @@ namespace clbl {
         pmf_ptr_wrapper()
         {}
 
-        pmf_ptr_wrapper(TMemberFnPtr f_ptr, TPtr&& o_ptr)
+        inline constexpr pmf_ptr_wrapper(TMemberFnPtr f_ptr, TPtr&& o_ptr)
             : data{ f_ptr, std::forward<TPtr>(o_ptr) }
         {}
 
-        inline pmf_ptr_wrapper(TMemberFnPtr f_ptr, TPtr& o_ptr)
+        inline constexpr pmf_ptr_wrapper(TMemberFnPtr f_ptr, TPtr& o_ptr)
             : data{ f_ptr, o_ptr }
         {}
 
+        inline constexpr pmf_ptr_wrapper(const volatile invocation_data_type& d)
+            : data{ d }
+        {}
+
         inline pmf_ptr_wrapper(my_type& other) = default;
         inline pmf_ptr_wrapper(const my_type& other) = default;
         inline pmf_ptr_wrapper(my_type&& other) = default;
 
+        //calls through the stored PMF
+        template<qualify_flags Flags, typename Data, typename... Fargs>
+        static inline constexpr auto
+        invoke_data(Data& d, Fargs&&... a)
+            noexcept(noexcept((harden_cast<Flags | member_object_flags<TMemberFnPtr> >(*d.object_ptr).*d.pmf)(std::forward<Fargs>(a)...)))
+            -> decltype((harden_cast<Flags | member_object_flags<TMemberFnPtr> >(*d.object_ptr).*d.pmf)(std::forward<Fargs>(a)...)) {
+            return (harden_cast<Flags | member_object_flags<TMemberFnPtr> >(*d.object_ptr).*d.pmf)(std::forward<Fargs>(a)...);
+        }
+
+        //calls through compressed or devirtualized data, if the call would be valid with the original PMF
+        template<qualify_flags Flags, typename Data, typename... Fargs>
+        static inline auto
+        invoke_data(Data& d, Fargs&&... a)
+            noexcept(noexcept(d.invoke(std::forward<Fargs>(a)...)))
+            -> decltype(void((harden_cast<Flags | member_object_flags<TMemberFnPtr> >(*std::declval<TPtr&>()).*std::declval<TMemberFnPtr>())(std::forward<Fargs>(a)...)),
+                d.invoke(std::forward<Fargs>(a)...)) {
+            return d.invoke(std::forward<Fargs>(a)...);
+        }
+
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) {
-            return CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV,
-                data.object_ptr, data.pmf, std::forward<Fargs>(a)...);
+        inline constexpr auto operator()(Fargs&&... a)
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, data, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV, data, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV,
+                data, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const {
-            return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const,
-                data.object_ptr, data.pmf, std::forward<Fargs>(a)...);
+        inline constexpr auto operator()(Fargs&&... a) const
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, data, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const, data, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const,
+                data, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) volatile {
-            return CLBL_UPCAST_AND_CALL_MEMBER_PTR(volatile,
-                data.object_ptr, data.pmf, std::forward<Fargs>(a)...);
+        inline constexpr auto operator()(Fargs&&... a) volatile
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, data, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile, data, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile,
+                data, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const volatile {
-            return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const volatile,
-                data.object_ptr, data.pmf, std::forward<Fargs>(a)...);
+        inline constexpr auto operator()(Fargs&&... a) const volatile
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, data, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile, data, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile,
+                data, std::forward<Fargs>(a)...);
         }
 
         template<typename T = UnderlyingType, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
@@ -117,37 +157,71 @@ namespace clbl {
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
-                return CLBL_UPCAST_AND_CALL_MEMBER_PTR(__CLBL_NO_CV,
-                    d.object_ptr, d.pmf, args...);
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV,
+                    d, args...);
+            };
+        }
+
+        template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        static inline constexpr auto
+        copy_invocation(my_type&& c) {
+            return[d = std::move(c.data)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(__CLBL_NO_CV,
+                    d, args...);
             };
         }
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto 
         copy_invocation(const my_type& c) {
-            return[d = c.data](auto&&... args){ 
-                return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const, 
-                    d.object_ptr, d.pmf, args...);
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const,
+                    d, args...);
             };
         }
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(volatile my_type& c) {
-            return[d = c.data](auto&&... args) mutable { 
-                return CLBL_UPCAST_AND_CALL_MEMBER_PTR(volatile,
-                    d.object_ptr, d.pmf, args...);
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(volatile,
+                    d, args...);
             };
         }
 
         template<typename T = UnderlyingType, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(const volatile my_type& c) {
-            return[d = c.data](auto&&... args){ 
-                return CLBL_UPCAST_AND_CALL_MEMBER_PTR(const volatile,
-                    d.object_ptr, d.pmf, args...);
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_INVOCATION_DATA(const volatile,
+                    d, args...);
             };
         }
+
+#if CLBL_COMPACT_PMF
+        /*
+        clbl::convert_to prefers compact_invocation over copy_invocation. A raw pointer to
+        a polymorphic class keeps its PMF as it is (24 bytes), so its glue splits the PMF
+        into a code word and a pre-adjusted "this" instead (see detail::compact_pmf_invocation)
+        */
+        template<typename Self, typename Data = invocation_data_type, typename T = UnderlyingType, std::enable_if_t<
+            !is_clbl<T> && std::is_pointer<TPtr>::value
+            && std::is_same<Data, indirect_pmf_invocation_data<TPtr, TMemberFnPtr> >::value
+            && std::is_same<std::remove_cv_t<no_ref<Self> >, my_type>::value, dummy>* = nullptr,
+            typename Invocation = detail::compact_pmf_invocation<
+                noexcept((harden_cast<cv<no_ref<Self> > | cv_flags | member_object_flags<TMemberFnPtr> >(*std::declval<TPtr&>()).*std::declval<TMemberFnPtr&>())(std::declval<Args>()...)),
+                Return, Args...> >
+        static inline Invocation
+        compact_invocation(Self&& c) {
+            TMemberFnPtr pmf = c.data.pmf;
+            return{ detail::compact_pmf_code(pmf), detail::compact_pmf_object(pmf, static_cast<TPtr>(c.data.object_ptr)) };
+        }
+#endif
     };
 }
 
@@ -15,7 +15,10 @@
 namespace clbl {
 
     /*
-    pmf_wrapper wraps a PMF and an object with which to call it.
+    pmf_wrapper wraps a PMF and an object with which to call it. The object
+    is only an rvalue in the && overloads of operator(), and overloads that
+    can't call the PMF (e.g. an lvalue wrapper with a &&-qualified PMF)
+    don't take part in overload resolution.
     */
     template<typename, qualify_flags, typename,
         typename, typename Failure>
@@ -31,8 +34,8 @@ namespace clbl {
         using arg_types = std::tuple<Args...>;
         using clbl_tag = pmf_tag;
         using creator = Creator;
-        using forwarding_glue = Return(forward<Args>...);
-        using invocation_data_type = pmf_invocation_data<apply_qualifiers<T, CvFlags>, TMemberFnPtr>;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = pmf_invocation_data<T, TMemberFnPtr>;
         using my_type = pmf_wrapper<Creator, CvFlags, T, TMemberFnPtr, decayed_member_fn_ptr>;
         using return_type = Return;
         using type = Return(Args...);
@@ -46,11 +49,11 @@ namespace clbl {
 
         invocation_data_type data;
 
-        inline pmf_wrapper(TMemberFnPtr f_ptr, T&& o)
+        inline constexpr pmf_wrapper(TMemberFnPtr f_ptr, T&& o)
             : data{ f_ptr, std::forward<T>(o) }
         {}
 
-        inline pmf_wrapper(TMemberFnPtr f_ptr, T& o)
+        inline constexpr pmf_wrapper(TMemberFnPtr f_ptr, T& o)
             : data{ f_ptr, o }
         {}
 
@@ -58,98 +61,150 @@ namespace clbl {
         inline pmf_wrapper(const my_type& other) = default;
         inline pmf_wrapper(my_type&& other) = default;
 
-        inline pmf_wrapper(volatile my_type& other)
-            : data(other.data)
-        {}
-
-        inline pmf_wrapper(const volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr pmf_wrapper(Other& other)
             : data(other.data)
         {}
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) {
+        inline constexpr auto operator()(Fargs&&... a) &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, data.object, data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, data.object, data.pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
                 data.object, data.pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const {
+        inline constexpr auto operator()(Fargs&&... a) const &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, data.object, data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, data.object, data.pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const,
                 data.object, data.pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) volatile {
+        inline constexpr auto operator()(Fargs&&... a) volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, data.object, data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, data.object, data.pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile,
                 data.object, data.pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const volatile {
+        inline constexpr auto operator()(Fargs&&... a) const volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, data.object, data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, data.object, data.pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile,
                 data.object, data.pmf, std::forward<Fargs>(a)...);
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, std::move(data.object), data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, std::move(data.object), data.pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
+                std::move(data.object), data.pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) const &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, std::move(data.object), data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, std::move(data.object), data.pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const,
+                std::move(data.object), data.pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, std::move(data.object), data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, std::move(data.object), data.pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile,
+                std::move(data.object), data.pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) const volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, std::move(data.object), data.pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, std::move(data.object), data.pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile,
+                std::move(data.object), data.pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(T& c) {
+        copy_invocation(U& c) {
             return no_ref<decltype(c.data.object)>::copy_invocation(
                 harden_cast<cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(const T& c) {
+        copy_invocation(const U& c) {
             return no_ref<decltype(c.data.object)>::copy_invocation(
                 harden_cast<qflags::const_ | cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(volatile T& c) {
+        copy_invocation(volatile U& c) {
             return no_ref<decltype(c.data.object)>::copy_invocation(
                 harden_cast<qflags::volatile_ | cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(const volatile T& c) {
+        copy_invocation(const volatile U& c) {
             return no_ref<decltype(data.object)>::copy_invocation(
                 harden_cast<qflags::const_ | qflags::volatile_ | cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
+                    d.object, d.pmf, args...);
+            };
+        }
+
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
+        static inline constexpr auto
+        copy_invocation(my_type&& c) {
+            return[d = std::move(c.data)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
                     d.object, d.pmf, args...);
             };
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(const my_type& c) {
-            return[d = c.data](auto&&... args){
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const,
                     d.object, d.pmf, args...);
             };
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(volatile my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile,
                     d.object, d.pmf, args...);
             };
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto copy_invocation(const volatile my_type& c) {
-            return[d = c.data](auto&&... args){
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile,
                     d.object, d.pmf, args...);
             };
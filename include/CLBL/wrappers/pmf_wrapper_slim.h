@@ -31,8 +31,8 @@ namespace clbl {
         using arg_types = std::tuple<Args...>;
         using clbl_tag = pmf_tag;
         using creator = Creator;
-        using forwarding_glue = Return(forward<Args>...);
-        using invocation_data_type = pmf_invocation_data_slim<apply_qualifiers<T, CvFlags>, TMemberFnPtr, Pmf>;
+        using forwarding_glue = Return(glue_arg<Args>...);
+        using invocation_data_type = pmf_invocation_data_slim<T, TMemberFnPtr, Pmf>;
         using my_type = pmf_wrapper_slim<Creator, CvFlags, T, TMemberFnPtr, Pmf, decayed_member_fn_ptr>;
         using return_type = Return;
         using type = Return(Args...);
@@ -46,11 +46,11 @@ namespace clbl {
 
         invocation_data_type data;
 
-        inline pmf_wrapper_slim(T&& o)
+        inline constexpr pmf_wrapper_slim(T&& o)
             : data{ std::forward<T>(o) }
         {}
 
-        inline pmf_wrapper_slim(T& o)
+        inline constexpr pmf_wrapper_slim(T& o)
             : data{ o }
         {}
 
@@ -58,101 +58,153 @@ namespace clbl {
         inline pmf_wrapper_slim(const my_type& other) = default;
         inline pmf_wrapper_slim(my_type&& other) = default;
 
-        inline pmf_wrapper_slim(volatile my_type& other)
-            : data(other.data)
-        {}
-
-        inline pmf_wrapper_slim(const volatile my_type& other)
+        template<typename Other, std::enable_if_t<
+            is_volatile_copy_of<my_type, Other>, dummy>* = nullptr>
+        inline constexpr pmf_wrapper_slim(Other& other)
             : data(other.data)
         {}
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) {
+        inline constexpr auto operator()(Fargs&&... a) &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
                 data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const {
+        inline constexpr auto operator()(Fargs&&... a) const &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const,
                 data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) volatile {
+        inline constexpr auto operator()(Fargs&&... a) volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile,
                 data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
         template<typename... Fargs>
-        inline Return operator()(Fargs&&... a) const volatile {
+        inline constexpr auto operator()(Fargs&&... a) const volatile &
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
             return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile,
                 data.object, invocation_data_type::pmf, std::forward<Fargs>(a)...);
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
+                std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) const &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const,
+                std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile,
+                std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename... Fargs>
+        inline constexpr auto operator()(Fargs&&... a) const volatile &&
+            noexcept(noexcept(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...)))
+            -> return_if_valid<Return, decltype(CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile, std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...))> {
+            return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile,
+                std::move(data.object), invocation_data_type::pmf, std::forward<Fargs>(a)...);
+        }
+
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(T& c) {
+        copy_invocation(U& c) {
             return no_ref<decltype(c.data.object)>::copy_invocation(
                 harden_cast<cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(const T& c) {
+        copy_invocation(const U& c) {
             return no_ref<decltype(c.data.object)>::copy_invocation(
                 harden_cast<qflags::const_ | cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(volatile T& c) {
+        copy_invocation(volatile U& c) {
             return no_ref<decltype(c.data.object)>::copy_invocation(
                 harden_cast<qflags::volatile_ | cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
-        copy_invocation(const volatile T& c) {
+        copy_invocation(const volatile U& c) {
             return no_ref<decltype(data.object)>::copy_invocation(
                 harden_cast<qflags::const_ | qflags::volatile_ | cv_flags>(c.data.object)
             );
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
+                return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
+                    d.object, decltype(d)::pmf, args...);
+            };
+        }
+
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
+        static inline constexpr auto
+        copy_invocation(my_type&& c) {
+            return[d = std::move(c.data)](auto&&... args) mutable
+                noexcept(noexcept(std::declval<my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(__CLBL_NO_CV,
                     d.object, decltype(d)::pmf, args...);
             };
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(const my_type& c) {
-            return[d = c.data](auto&&... args){
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const,
                     d.object, decltype(d)::pmf, args...);
             };
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(volatile my_type& c) {
-            return[d = c.data](auto&&... args) mutable {
+            return[d = c.data](auto&&... args) mutable
+                noexcept(noexcept(std::declval<volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(volatile,
                     d.object, decltype(d)::pmf, args...);
             };
         }
 
-        template<typename T = underlying_type, std::enable_if_t<!is_clbl<T>, dummy>* = nullptr>
+        template<typename U = underlying_type, std::enable_if_t<!is_clbl<U>, dummy>* = nullptr>
         static inline constexpr auto
         copy_invocation(const volatile my_type& c) {
-            return[d = c.data](auto&&... args){
+            return[d = c.data](auto&&... args)
+                noexcept(noexcept(std::declval<const volatile my_type&>()(args...))) -> decltype(auto) {
                 return CLBL_UPCAST_AND_CALL_MEMBER_VAL(const volatile,
                     d.object, decltype(d)::pmf, args...);
             };
@@ -0,0 +1,95 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "overload_definitions.h"
+
+#include <functional>
+#include <iostream>
+#include <type_traits>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace bind_constant_tests_detail {
+
+    inline long kernel(int model, int steps, long spot) {
+        return model == 4 ? spot * steps : spot - steps;
+    }
+
+    constexpr int product(int a, int b) { return a * b; }
+
+    inline bool flagged(int i, bool flag, long value) { return flag && value == i; }
+
+    //a target can also read a bound constant as a constant expression
+    struct static_steps {
+        template<typename Steps>
+        long operator()(Steps, long spot) const {
+            static_assert(Steps::value > 0, "");
+            return spot * Steps::value;
+        }
+    };
+}
+
+void bind_constant_tests() {
+
+#ifdef CLBL_BIND_CONSTANT_TESTS
+    std::cout << "running CLBL_BIND_CONSTANT_TESTS" << std::endl;
+
+    using namespace bind_constant_tests_detail;
+
+    {
+        auto f = bind_constant<int, 4, 2>(&kernel);
+        auto g = bind_constant<int, 3>(fwrap(&kernel));
+
+        STATIC_TEST((std::is_same<decltype(f)::type, long(long)>::value));
+        STATIC_TEST((std::is_same<decltype(g)::type, long(int, long)>::value));
+
+        TEST(f(10) == 20);
+        TEST(g(2, 10) == 8);
+    }
+    {
+        //the constants take no space
+        auto f = bind_constant<int, 4, 2>(fwrap(&kernel));
+        auto g = bind_constant<int, 4, 2>(CLBL_FNWRAP(&kernel));
+        auto same_values = bind_constant<int, 3, 3>(CLBL_FNWRAP(&product));
+
+        STATIC_TEST(sizeof(f) == sizeof(fwrap(&kernel)));
+        STATIC_TEST(sizeof(g) == 1);
+        STATIC_TEST(sizeof(same_values) == 1);
+        STATIC_TEST(std::is_empty<decltype(g)::invocation_data_type>::value);
+
+        TEST(g(10) == 20);
+        TEST(same_values() == 9);
+    }
+    {
+        //ambiguous callables receive the bound constant objects
+        auto f = bind_constant<int, 3>(generic_product{});
+        auto s = bind_constant<int, 5>(static_steps{});
+
+        TEST(f(2) == 6);
+        TEST(harden<long(long) const>(f)(5) == 15);
+        TEST(s(2) == 10);
+    }
+    {
+        auto f = bind_constant<int, 2>(CLBL_FNWRAP(&product));
+        auto std_func = convert_to<std::function>(f);
+        auto ref = make_function_ref(f);
+
+        TEST(std_func(21) == 42);
+        TEST(ref(21) == 42);
+    }
+    {
+        constexpr auto f = bind_constant<int, 6>(CLBL_FNWRAP(&product));
+        STATIC_TEST(f(7) == 42);
+    }
+#ifdef __cpp_nontype_template_parameter_auto
+    {
+        //the values can have different types since C++17
+        auto f = bind_constant<3, true>(&flagged);
+        STATIC_TEST((std::is_same<decltype(f)::type, bool(long)>::value));
+        TEST(f(3L));
+        TEST(!f(4L));
+    }
+#endif
+
+#endif
+}
\ No newline at end of file
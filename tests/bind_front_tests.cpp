@@ -0,0 +1,179 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "overload_definitions.h"
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace bind_front_tests_detail {
+
+    struct empty_tag {};
+    struct other_tag {};
+
+    inline int tagged_sum(empty_tag, int a, int b) { return a + b; }
+    inline int two_tags(empty_tag, other_tag, int a) { return a; }
+    inline int weighted(long weight, int a, int b) { return static_cast<int>(weight) * (a + b); }
+
+    struct volatile_weighted {
+        volatile_weighted() = default;
+        volatile_weighted(const volatile_weighted&) = default;
+        volatile_weighted(const volatile volatile_weighted&) {}
+
+        int operator()(long weight, int a, int b) const volatile { return weighted(weight, a, b); }
+    };
+
+    struct counter {
+        int count = 0;
+        int add(int a, int b) { return count += a + b; }
+    };
+
+    inline std::string take(std::unique_ptr<std::string> s, const char* suffix) {
+        return *s + suffix;
+    }
+
+    inline std::string peek(const std::unique_ptr<std::string>& s, const char* suffix) {
+        return *s + suffix;
+    }
+
+    inline int bump(int& i, int by) { return i += by; }
+
+    constexpr int product(int a, int b) { return a * b; }
+}
+
+void bind_front_tests() {
+
+#ifdef CLBL_BIND_FRONT_TESTS
+    std::cout << "running CLBL_BIND_FRONT_TESTS" << std::endl;
+
+    using namespace bind_front_tests_detail;
+    using namespace std::placeholders;
+
+    {
+        //the remaining signature is deduced from the wrapped callable
+        auto f = bind_front(&weighted, 2L);
+        auto g = bind_front(fwrap(&weighted), 2L, 3);
+
+        STATIC_TEST((std::is_same<decltype(f)::type, int(int, int)>::value));
+        STATIC_TEST((std::is_same<decltype(g)::type, int(int)>::value));
+        STATIC_TEST((std::is_same<args<decltype(g)>, std::tuple<int> >::value));
+        STATIC_TEST(!decltype(f)::is_ambiguous);
+
+        TEST(f(3, 4) == 14);
+        TEST(g(4) == 14);
+        TEST(bind_front(g, 5)() == 16);
+    }
+    {
+        //bound arguments are stored inline, and empty ones take no space
+        auto f = bind_front(&tagged_sum, empty_tag{});
+        auto g = bind_front(CLBL_FNWRAP(&tagged_sum), empty_tag{});
+        auto h = bind_front(CLBL_FNWRAP(&two_tags), empty_tag{}, other_tag{});
+        auto w = bind_front(&weighted, 2L);
+
+        STATIC_TEST(sizeof(f) == sizeof(void(*)()));
+        STATIC_TEST(sizeof(g) == 1);
+        STATIC_TEST(sizeof(h) == 1);
+        STATIC_TEST(sizeof(w) == sizeof(void(*)()) + sizeof(long));
+        STATIC_TEST(is_trivially_relocatable<decltype(w)>);
+
+        //never larger than the std::bind equivalent
+        STATIC_TEST(sizeof(f) <= sizeof(std::bind(&tagged_sum, empty_tag{}, _1, _2)));
+        STATIC_TEST(sizeof(g) < sizeof(std::bind(&tagged_sum, empty_tag{}, _1, _2)));
+        STATIC_TEST(sizeof(w) <= sizeof(std::bind(&weighted, 2L, _1, _2)));
+
+        TEST(f(1, 2) == 3);
+        TEST(g(1, 2) == 3);
+        TEST(h(7) == 7);
+    }
+    {
+        //CV overload selection is kept
+        auto f = bind_front(int_cv_overloads{}, 1);
+        const auto& c = f;
+
+        TEST(f() == "non-const");
+        TEST(c() == "const");
+        TEST(harden<std::string() const>(f)() == "const");
+    }
+    {
+        //copies and calls of volatile wrappers work when the bound callable supports them
+        volatile auto v = bind_front(volatile_weighted{}, 2L);
+        auto copy = v;
+        auto std_func = convert_to<std::function>(v);
+
+        TEST(v(1, 2) == 6);
+        TEST(copy(1, 2) == 6);
+        TEST(std_func(1, 2) == 6);
+    }
+    {
+        //binding to a member function with an object
+        counter object{};
+        auto f = bind_front(fwrap(&object, &counter::add), 1);
+
+        TEST(f(2) == 3);
+        TEST(f(3) == 7);
+        TEST(object.count == 7);
+    }
+    {
+        //ambiguous callables stay ambiguous until they are hardened
+        auto f = bind_front(generic_product{}, 3);
+        STATIC_TEST(decltype(f)::is_ambiguous);
+        TEST(f(2) == 6);
+        TEST(f(0.5) == 1.5);
+
+        auto h = harden<long(long) const>(f);
+        STATIC_TEST((std::is_same<decltype(h)::type, long(long)>::value));
+        TEST(h(5) == 15);
+
+        auto a = harden<auto_(double) const>(f);
+        STATIC_TEST((std::is_same<decltype(a)::return_type, double>::value));
+        TEST(a(0.5) == 1.5);
+    }
+    {
+        //hardening pins the overload of the bound callable, with the bound arguments in front
+        auto f = bind_front(int_then_int_or_long{}, 0);
+        TEST(f(1) == 1);
+
+        auto h = harden<int(long) const>(f);
+        STATIC_TEST((std::is_same<decltype(h)::type, int(long)>::value));
+        TEST(h(1) == 2);
+        TEST(convert_to<std::function>(h)(1) == 2);
+    }
+    {
+        //conversions
+        auto f = bind_front(CLBL_FNWRAP(&weighted), 2L);
+        auto std_func = convert_to<std::function>(f);
+        auto ref = make_function_ref(f);
+
+        TEST(std_func(1, 2) == 6);
+        TEST(ref(1, 2) == 6);
+        STATIC_TEST((fits_small_buffer<std::function, decltype(f)&>) == (fits_small_buffer<std::function, decltype(fwrap(&weighted))&>));
+    }
+    {
+        //an rvalue wrapper moves its bound arguments into the call
+        auto f = bind_front(&take, std::unique_ptr<std::string>(new std::string("bound")));
+        TEST(std::move(f)("!") == "bound!");
+
+        //and converting an rvalue wrapper moves them into the type-erased function
+        auto u = convert_to<unique_function>(bind_front(&peek, std::unique_ptr<std::string>(new std::string("moved"))));
+        TEST(u("?") == "moved?");
+    }
+    {
+        //reference_wrapper binds by reference
+        int i = 1;
+        auto f = bind_front(&bump, std::ref(i));
+        f(2);
+        f(3);
+        TEST(i == 6);
+    }
+    {
+        constexpr auto f = bind_front(CLBL_FNWRAP(&product), 6);
+        STATIC_TEST(f(7) == 42);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "overload_definitions.h"
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace compose_tests_detail {
+
+    inline int parse(const char* s) { return s[0] - '0'; }
+    inline long twice(int i) { return 2L * i; }
+    inline std::string show(long l) { return std::to_string(l); }
+
+    struct add_one { int operator()(int i) const { return i + 1; } };
+    struct square { int operator()(int i) const { return i * i; } };
+
+    struct generic_negate {
+        template<typename T>
+        auto operator()(T t) const { return -t; }
+    };
+
+    inline int identity(int i) { return i; }
+
+    //counts every copy and move of an intermediate result
+    struct tracked {
+        static int copies;
+        static int moves;
+
+        int value;
+
+        explicit tracked(int v) : value(v) {}
+        tracked(const tracked& other) : value(other.value) { ++copies; }
+        tracked(tracked&& other) : value(other.value) { ++moves; }
+    };
+
+    int tracked::copies = 0;
+    int tracked::moves = 0;
+
+    inline tracked make_tracked(int i) { return tracked{ i }; }
+    inline tracked bump_tracked(tracked t) { return tracked{ t.value + 1 }; }
+    inline int read_tracked(tracked t) { return t.value; }
+
+    constexpr int triple(int i) { return 3 * i; }
+    constexpr int decrement(int i) { return i - 1; }
+}
+
+void compose_tests() {
+
+#ifdef CLBL_COMPOSE_TESTS
+    std::cout << "running CLBL_COMPOSE_TESTS" << std::endl;
+
+    using namespace compose_tests_detail;
+
+    {
+        //stages are called in the order they are given
+        auto f = compose(&parse, &twice, &show);
+
+        STATIC_TEST((std::is_same<decltype(f)::type, std::string(const char*)>::value));
+        STATIC_TEST(!decltype(f)::is_ambiguous);
+
+        TEST(f("4") == "8");
+        TEST(compose(add_one{}, square{})(2) == 9);
+        TEST(compose(square{}, add_one{})(2) == 5);
+        TEST(compose(&parse)("7") == 7);
+    }
+    {
+        //intermediate results go straight into the next stage
+        auto f = compose(&make_tracked, &bump_tracked, &bump_tracked, &read_tracked);
+        tracked::copies = 0;
+        tracked::moves = 0;
+
+        TEST(f(1) == 3);
+        TEST(tracked::copies == 0);
+    }
+    {
+        //the pipeline is no larger than its stages, and empty stages take no space
+        auto f = compose(CLBL_FNWRAP(&parse), CLBL_FNWRAP(&twice), CLBL_FNWRAP(&show));
+        auto g = compose(add_one{}, square{});
+
+        STATIC_TEST(sizeof(f) == 1);
+        STATIC_TEST(sizeof(g) == sizeof(fwrap(add_one{})) + sizeof(fwrap(square{})));
+        TEST(f("3") == "6");
+        TEST(g(2) == 9);
+
+        //pipelines can be composed again
+        TEST(compose(g, &twice)(2) == 18);
+    }
+    {
+        //the whole pipeline converts to a single type-erased function
+        auto f = compose(CLBL_FNWRAP(&parse), CLBL_FNWRAP(&twice), CLBL_FNWRAP(&show));
+        auto std_func = convert_to<std::function>(f);
+        auto ref = make_function_ref(f);
+
+        STATIC_TEST((fits_small_buffer<std::function, decltype(f)&>));
+        TEST(std_func("5") == "10");
+        TEST(ref("6") == "12");
+    }
+    {
+        //ambiguous first stages make the pipeline ambiguous until it is hardened
+        auto f = compose(generic_negate{}, &twice);
+        STATIC_TEST(decltype(f)::is_ambiguous);
+        TEST(f(3) == -6);
+
+        auto h = harden<long(int) const>(f);
+        STATIC_TEST((std::is_same<decltype(h)::type, long(int)>::value));
+        TEST(h(4) == -8);
+        TEST(convert_to<std::function>(h)(5) == -10);
+
+        //later ambiguous stages are deduced from the stage before them
+        auto g = compose(&parse, generic_negate{});
+        STATIC_TEST((std::is_same<decltype(g)::type, int(const char*)>::value));
+        TEST(g("2") == -2);
+    }
+    {
+        //harden selects the overload of the first stage, and the next stage takes its result
+        auto f = compose(int_or_long{}, &identity);
+        TEST(f(1) == 1);
+
+        auto h = harden<int(long) const>(f);
+        STATIC_TEST((std::is_same<decltype(h)::type, int(long)>::value));
+        TEST(h(1) == 2);
+        TEST(convert_to<std::function>(h)(1) == 2);
+    }
+    {
+        //CV overload selection applies to every stage
+        auto f = compose(add_one{}, int_cv_overloads{});
+        const auto& c = f;
+
+        TEST(f(1) == "non-const");
+        TEST(c(1) == "const");
+        TEST(harden<std::string(int) const>(f)(1) == "const");
+    }
+    {
+        constexpr auto f = compose(CLBL_FNWRAP(&triple), CLBL_FNWRAP(&decrement));
+        STATIC_TEST(f(4) == 11);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "int_char_definitions.h"
+#include "inheritance_definitions.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+void compressed_pmf_tests() {
+
+#ifdef CLBL_COMPRESSED_PMF_TESTS
+    std::cout << "running CLBL_COMPRESSED_PMF_TESTS" << std::endl;
+
+    {
+        int_char_struct int_char_object{};
+
+        auto f = fwrap(&int_char_object, &int_char_struct::func);
+        auto g = fwrap(std::make_shared<int_char_struct>(), &int_char_struct::func);
+
+#if CLBL_COMPACT_PMF
+        STATIC_TEST(sizeof(f) == 2 * sizeof(void*));
+        STATIC_TEST((std::is_same<decltype(f)::invocation_data_type,
+            compressed_pmf_invocation_data<int_char_struct*,
+                decltype(&int_char_struct::func), const char*(int, char)> >::value));
+#endif
+        //smart pointers keep the PMF as it is
+        STATIC_TEST((std::is_same<decltype(g)::invocation_data_type,
+            indirect_pmf_invocation_data<std::shared_ptr<int_char_struct>,
+                decltype(&int_char_struct::func)> >::value));
+
+        TEST(f(1, 'c') == test_id::int_char_struct_func);
+        TEST(g(1, 'c') == test_id::int_char_struct_func);
+    }
+    {
+        //the "this" adjustment is applied once, on construction
+        plain_derived d{};
+
+        auto adjusted = fwrap(&d, static_cast<long(plain_derived::*)(long) const>(&plain_second_base::add));
+
+#if CLBL_COMPACT_PMF
+        STATIC_TEST(sizeof(adjusted) == 2 * sizeof(void*));
+        STATIC_TEST((std::is_same<decltype(adjusted)::invocation_data_type,
+            compressed_pmf_invocation_data<plain_derived*,
+                long(plain_derived::*)(long) const, long(long)> >::value));
+#endif
+
+        TEST(adjusted(5) == 7);
+
+        const auto c = adjusted;
+        TEST(c(6) == 8);
+
+        d.second = 20;
+        TEST(adjusted(5) == 25);
+    }
+    {
+        //a PMF of a polymorphic class may be virtual, so it is stored as it is
+        derived d{};
+
+        auto adjusted = fwrap(&d, static_cast<long(derived::*)(long) const>(&second_base::add));
+        auto overridden = fwrap(&d, &derived::scaled);
+        auto through_base = fwrap(static_cast<second_base*>(&d), &second_base::scaled);
+
+        STATIC_TEST((std::is_same<decltype(through_base)::invocation_data_type,
+            indirect_pmf_invocation_data<second_base*, decltype(&second_base::scaled)> >::value));
+
+        TEST(adjusted(5) == 7);
+        TEST(overridden(5) == 15);
+        TEST(through_base(5) == 15);
+
+        d.second = 20;
+        d.third = 30;
+        TEST(adjusted(5) == 25);
+        TEST(through_base(5) == 150);
+    }
+    {
+        //rewrapping, hardening and conversions see the same target
+        plain_derived d{};
+        derived v{};
+
+        auto adjusted = fwrap(&d, static_cast<long(plain_derived::*)(long) const>(&plain_second_base::add));
+        auto through_base = fwrap(static_cast<second_base*>(&v), &second_base::scaled);
+
+        auto rewrapped = fwrap(adjusted);
+        auto moved = fwrap(std::move(rewrapped));
+        auto hardened = harden<long(long) const>(adjusted);
+        auto virtual_hardened = harden<long(long)>(through_base);
+        auto ref = make_function_ref(adjusted);
+        auto std_func = convert_to<std::function>(adjusted);
+        auto virtual_std_func = convert_to<std::function>(through_base);
+
+        STATIC_TEST((std::is_same<decltype(rewrapped), decltype(adjusted)>::value));
+        STATIC_TEST((std::is_same<decltype(moved), decltype(adjusted)>::value));
+
+        TEST(moved(5) == 7);
+        TEST(hardened(5) == 7);
+        TEST(virtual_hardened(5) == 15);
+        TEST(ref(5) == 7);
+        TEST(std_func(5) == 7);
+        TEST(virtual_std_func(5) == 15);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <iostream>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace constexpr_tests_detail {
+
+    constexpr int square(int i) { return i * i; }
+    constexpr int cube(int i) { return i * i * i; }
+
+    struct adder {
+        int base;
+        constexpr int operator()(int i) const { return base + i; }
+        constexpr int twice(int i) const { return 2 * (base + i); }
+    };
+
+    struct overloaded {
+        constexpr int operator()(int i) const { return i + 1; }
+        constexpr int operator()(int i, int j) const { return i * j; }
+    };
+
+    struct generic {
+        template<typename T>
+        constexpr T operator()(T t) const { return t + t; }
+    };
+
+    struct literal {
+        int value;
+    };
+
+    constexpr int through_vessels(int i) {
+        forward<const int&> by_ref{ i };
+        //a vessel can point at its argument, which must outlive it - never a temporary
+        literal l{ i };
+        forward<literal> by_value{ l };
+        return static_cast<const int&>(by_ref) + static_cast<literal>(by_value).value;
+    }
+
+    constexpr adder static_adder{ 10 };
+
+    //a dispatch table built at compile time - every free_fn_wrapper with the same signature has the same type
+    constexpr decltype(fwrap(&square)) powers[] = { fwrap(&square), fwrap(&cube) };
+}
+
+void constexpr_tests() {
+
+#ifdef CLBL_CONSTEXPR_TESTS
+    std::cout << "running CLBL_CONSTEXPR_TESTS" << std::endl;
+
+    using namespace constexpr_tests_detail;
+
+    {
+        constexpr auto f = fwrap(&square);
+        constexpr auto g = CLBL_FNWRAP(&cube);
+        STATIC_TEST(f(3) == 9);
+        STATIC_TEST(g(3) == 27);
+        STATIC_TEST(powers[0](4) == 16);
+        STATIC_TEST(powers[1](4) == 64);
+        TEST(powers[1](2) == 8);
+    }
+    {
+        constexpr auto f = fwrap(adder{ 5 });
+        constexpr auto g = fwrap(adder{ 5 }, &adder::twice);
+        constexpr auto h = CLBL_PMFWRAP(&adder::twice, adder{ 1 });
+        STATIC_TEST(f(1) == 6);
+        STATIC_TEST(g(1) == 12);
+        STATIC_TEST(h(1) == 4);
+        STATIC_TEST(fwrap(adder{ 2 })(2) == 4);
+        STATIC_TEST(std::move(f)(2) == 7);
+    }
+    {
+        constexpr auto f = fwrap(&static_adder);
+        STATIC_TEST(f(1) == 11);
+    }
+    {
+        constexpr auto f = fwrap(overloaded{});
+        constexpr auto g = fwrap(generic{});
+        STATIC_TEST(f(2, 3) == 6);
+        STATIC_TEST(g(21) == 42);
+        STATIC_TEST(harden<int(int) const>(f)(1) == 2);
+        STATIC_TEST(harden<int(int, int) const>(f)(4, 5) == 20);
+        STATIC_TEST(harden<long(long) const>(g)(2) == 4);
+    }
+    {
+        STATIC_TEST(through_vessels(4) == 8);
+    }
+#if __cpp_constexpr >= 201603
+    {
+        //lambdas are implicitly constexpr since C++17
+        constexpr auto f = fwrap([](int i) { return i * 3; });
+        STATIC_TEST(f(3) == 9);
+    }
+#endif
+
+#endif
+}
\ No newline at end of file
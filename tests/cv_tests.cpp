@@ -293,7 +293,7 @@ void conversion_tests() {
 
         static_assert(std::is_same<
             decltype(stdn), 
-            std::function<const char* (forward<int>, forward<char>) > 
+            std::function<const char* (int, char) > 
         >::value, "");
 
         TEST(stdn(1, 'c') == test_id::overloaded_int_char_struct_op);
@@ -593,7 +593,7 @@ void conversion_tests() {
 
         static_assert(std::is_same<
             decltype(stdn),
-            std::function<const char* (forward<int>, forward<char>) >
+            std::function<const char* (int, char) >
         >::value, "");
 
         TEST(stdn(1, 'c') == test_id::overloaded_int_char_struct_op);
@@ -0,0 +1,151 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "overload_definitions.h"
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace decorate_tests_detail {
+
+    inline int add(int a, int b) { return a + b; }
+    inline void ignore(int) {}
+
+    //appends its name before and after the rest of the call
+    struct trace {
+        std::string* log;
+        char name;
+
+        template<typename Next, typename... Args>
+        decltype(auto) operator()(Next&& next, Args&&... a) const {
+            *log += name;
+            decltype(auto) result = std::forward<Next>(next)(std::forward<Args>(a)...);
+            *log += name;
+            return result;
+        }
+    };
+
+    //calls the rest of the stack only for valid arguments
+    struct reject_negative {
+        template<typename Next>
+        int operator()(Next&& next, int a, int b) const {
+            return a < 0 || b < 0 ? -1 : std::forward<Next>(next)(a, b);
+        }
+    };
+
+    struct double_result {
+        template<typename Next, typename... Args>
+        constexpr auto operator()(Next&& next, Args&&... a) const {
+            return 2 * std::forward<Next>(next)(std::forward<Args>(a)...);
+        }
+    };
+
+    //an observer that can be called through a volatile decorated wrapper
+    struct count_calls {
+        int* count;
+        template<typename... Args>
+        void operator()(const Args&...) const volatile { ++*count; }
+    };
+
+    constexpr int increment(int i) { return i + 1; }
+}
+
+void decorate_tests() {
+
+#ifdef CLBL_DECORATE_TESTS
+    std::cout << "running CLBL_DECORATE_TESTS" << std::endl;
+
+    using namespace decorate_tests_detail;
+
+    {
+        //the decorated wrapper has the same signature, and advice runs outermost first
+        std::string log;
+        auto f = decorate(&add, trace{ &log, 'a' }, trace{ &log, 'b' });
+
+        STATIC_TEST((std::is_same<decltype(f)::type, int(int, int)>::value));
+        STATIC_TEST((std::is_same<args<decltype(f)>, std::tuple<int, int> >::value));
+        STATIC_TEST(!decltype(f)::is_ambiguous);
+
+        TEST(f(1, 2) == 3);
+        TEST(log == "abba");
+    }
+    {
+        //before, after, and advice that doesn't call the rest of the stack
+        std::string log;
+        int last_result = 0;
+        auto f = decorate(CLBL_FNWRAP(&add),
+            before([&log](int a, int b) { log += std::to_string(a + b); }),
+            after([&last_result](int result) { last_result = result; }),
+            reject_negative{});
+
+        TEST(f(2, 3) == 5);
+        TEST(log == "5");
+        TEST(last_result == 5);
+
+        TEST(f(-2, 3) == -1);
+        TEST(log == "51");
+        TEST(last_result == -1);
+
+        bool called = false;
+        auto v = decorate(CLBL_FNWRAP(&ignore), after([&called]() { called = true; }));
+        v(1);
+        TEST(called);
+    }
+    {
+        //disabled advice compiles out, and empty advice takes no space
+        std::string log;
+        auto f = decorate(CLBL_FNWRAP(&add), advice_if<false>(trace{ &log, 'a' }), double_result{});
+        auto g = decorate(CLBL_FNWRAP(&add), advice_if<true>(trace{ &log, 'a' }));
+
+        STATIC_TEST(sizeof(f) == sizeof(CLBL_FNWRAP(&add)));
+        STATIC_TEST(sizeof(g) == sizeof(trace));
+        TEST(f(1, 2) == 6);
+        TEST(log.empty());
+        TEST(g(1, 2) == 3);
+        TEST(log == "aa");
+    }
+    {
+        //before and after advice can be called through a volatile wrapper, like any other layer
+        int count = 0;
+        volatile auto f = decorate(CLBL_FNWRAP(&add), before(count_calls{ &count }), after(count_calls{ &count }));
+        const volatile auto& cv = f;
+
+        TEST(f(1, 2) == 3);
+        TEST(cv(3, 4) == 7);
+        TEST(count == 4);
+    }
+    {
+        //harden reaches through the advice to the decorated callable, and the advice still runs
+        std::string log;
+        auto f = decorate(int_or_long{}, trace{ &log, 'a' }, double_result{});
+        STATIC_TEST(decltype(f)::is_ambiguous);
+        TEST(f(1) == 2);
+
+        auto h = harden<int(long) const>(f);
+        STATIC_TEST((std::is_same<decltype(h)::type, int(long)>::value));
+        TEST(h(1) == 4);
+        TEST(log == "aaaa");
+    }
+    {
+        //conversions erase the whole stack into one function
+        std::string log;
+        auto f = decorate(CLBL_FNWRAP(&add), trace{ &log, 'a' });
+        auto std_func = convert_to<std::function>(f);
+        auto ref = make_function_ref(f);
+
+        TEST(std_func(1, 2) == 3);
+        TEST(ref(3, 4) == 7);
+        TEST(log == "aaaa");
+        STATIC_TEST((fits_small_buffer<std::function, decltype(f)&>));
+    }
+    {
+        constexpr auto f = decorate(CLBL_FNWRAP(&increment), double_result{});
+        STATIC_TEST(f(4) == 10);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "inheritance_definitions.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <functional>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+void devirtualize_tests() {
+
+#ifdef CLBL_DEVIRTUALIZE_TESTS
+    std::cout << "running CLBL_DEVIRTUALIZE_TESTS" << std::endl;
+
+    {
+        derived d{};
+        second_base* base_ptr = &d;
+
+        auto f = fwrap(devirtualize, base_ptr, &second_base::scaled);
+        auto g = fwrap(devirtualize, base_ptr, &second_base::name);
+        auto h = fwrap(devirtualize, base_ptr, &second_base::add);
+        auto r = fwrap(devirtualize, std::ref(*base_ptr), &second_base::scaled);
+
+#if CLBL_COMPACT_PMF
+        STATIC_TEST(sizeof(f) == 2 * sizeof(void*));
+        STATIC_TEST((std::is_same<decltype(f)::invocation_data_type,
+            devirtualized_pmf_invocation_data<second_base*,
+                decltype(&second_base::scaled), long(long)> >::value));
+#endif
+        STATIC_TEST((std::is_same<decltype(f)::type, long(long)>::value));
+        STATIC_TEST((std::is_same<decltype(f), decltype(r)>::value));
+
+        TEST(f(3) == 9);
+        TEST(g(3) == "derived 6");
+        TEST(h(3) == 5);
+        TEST(r(3) == 9);
+
+        const auto c = g;
+        TEST(c(4) == "derived 7");
+
+        //the object is still referenced, not copied
+        d.third = 4;
+        TEST(f(3) == 12);
+        TEST(g(3) == "derived 7");
+    }
+    {
+        //rewrapping, hardening and conversions stay devirtualized
+        derived d{};
+        second_base* base_ptr = &d;
+
+        auto f = fwrap(devirtualize, base_ptr, &second_base::scaled);
+
+        auto rewrapped = fwrap(f);
+        auto hardened = harden<long(long)>(f);
+        auto ref = make_function_ref(f);
+        auto std_func = convert_to<std::function>(f);
+
+        STATIC_TEST((std::is_same<decltype(rewrapped), decltype(f)>::value));
+
+        TEST(rewrapped(3) == 9);
+        TEST(hardened(3) == 9);
+        TEST(ref(3) == 9);
+        TEST(std_func(3) == 9);
+    }
+    {
+        //a non-virtual member function doesn't read the object on construction, so it may be null
+        derived* null_ptr = nullptr;
+        auto f = fwrap(devirtualize, null_ptr, static_cast<long(derived::*)(long) const>(&second_base::add));
+        TEST(f.data.object_ptr == nullptr);
+
+        derived d{};
+        auto g = fwrap(devirtualize, &d, static_cast<long(derived::*)(long) const>(&second_base::add));
+        STATIC_TEST((std::is_same<decltype(f), decltype(g)>::value));
+        TEST(g(3) == 5);
+    }
+    {
+        //smart pointers fall back to call-time dispatch
+        std::shared_ptr<second_base> p = std::make_shared<derived>();
+
+        auto f = fwrap(devirtualize, p, &second_base::scaled);
+
+        STATIC_TEST((std::is_same<decltype(f)::invocation_data_type,
+            indirect_pmf_invocation_data<std::shared_ptr<second_base>,
+                decltype(&second_base::scaled)> >::value));
+
+        TEST(f(3) == 9);
+    }
+
+#endif
+}
\ No newline at end of file
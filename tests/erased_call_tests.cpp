@@ -0,0 +1,80 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace erased_call_tests_detail {
+
+    //12 arguments, mixing values, references and a move-only type
+    struct wide_callback {
+        long operator()(int a, long b, char c, double d, int& out, const std::string& s,
+            std::unique_ptr<int> p, int e, int f, int g, int h, int i) const {
+            out = a + static_cast<int>(s.size());
+            return a + b + c + static_cast<long>(d) + *p + e + f + g + h + i;
+        }
+    };
+
+    inline long sum8(int a, int b, int c, int d, int e, int f, int g, int h) { return a + b + c + d + e + f + g + h; }
+    inline long sum9(int a, int b, int c, int d, int e, int f, int g, int h, int i) { return a + b + c + d + e + f + g + h + i; }
+}
+
+void erased_call_tests() {
+
+#ifdef CLBL_ERASED_CALL_TESTS
+    std::cout << "running CLBL_ERASED_CALL_TESTS" << std::endl;
+
+    using namespace erased_call_tests_detail;
+
+    {
+        using eight = forwarding_glue<decltype(fwrap(&sum8))>;
+        using nine = forwarding_glue<decltype(fwrap(&sum9))>;
+
+        STATIC_TEST(function_ref<eight>::call_type::is_packed == (8 > CLBL_PACKED_GLUE_ARITY));
+        STATIC_TEST(function_ref<nine>::call_type::is_packed == (9 > CLBL_PACKED_GLUE_ARITY));
+
+        auto f = fwrap(&sum8);
+        auto g = fwrap(&sum9);
+
+        TEST(make_function_ref(f)(1, 2, 3, 4, 5, 6, 7, 8) == 36);
+        TEST(make_function_ref(g)(1, 2, 3, 4, 5, 6, 7, 8, 9) == 45);
+        TEST(convert_to<inline_capacity<16>::function>(g)(1, 2, 3, 4, 5, 6, 7, 8, 9) == 45);
+        TEST(convert_to<unique_function>(g)(1, 2, 3, 4, 5, 6, 7, 8, 9) == 45);
+    }
+    {
+        //packed arguments keep their value categories
+        auto wrapper = fwrap(wide_callback{});
+
+        using glue = forwarding_glue<decltype(wrapper)>;
+        STATIC_TEST(function_ref<glue>::call_type::is_packed == (12 > CLBL_PACKED_GLUE_ARITY));
+
+        auto ref = make_function_ref(wrapper);
+        auto inline_func = convert_to<inline_capacity<16>::function>(wrapper);
+        auto unique_func = convert_to<unique_function>(wrapper);
+        auto std_func = convert_to<std::function>(wrapper);
+
+        std::string s = "four";
+        int out = 0;
+
+        TEST(ref(1, 2, 3, 4.0, out, s, std::make_unique<int>(5), 6, 7, 8, 9, 10) == 55);
+        TEST(out == 5);
+
+        out = 0;
+        TEST(inline_func(1, 2, 3, 4.0, out, s, std::make_unique<int>(5), 6, 7, 8, 9, 10) == 55);
+        TEST(out == 5);
+
+        out = 0;
+        TEST(unique_func(1, 2, 3, 4.0, out, s, std::make_unique<int>(5), 6, 7, 8, 9, 10) == 55);
+        TEST(out == 5);
+
+        out = 0;
+        TEST(std_func(1, 2, 3, 4.0, out, s, std::make_unique<int>(5), 6, 7, 8, 9, 10) == 55);
+        TEST(out == 5);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace executor_tests_detail {
+
+    inline void add_to(std::atomic<long>* total, long value) { *total += value; }
+
+    struct accumulator {
+        std::atomic<long> total{ 0 };
+        void add(long value) { total += value; }
+    };
+
+    //too large for a task slot
+    struct big_task {
+        std::atomic<long>* total;
+        char padding[200];
+        void operator()() const { ++*total; }
+    };
+
+    //spawns more tasks from inside the pool
+    struct spawner {
+        executor* pool;
+        std::atomic<long>* total;
+        int depth;
+
+        void operator()() const {
+            ++*total;
+            if (depth > 0) {
+                pool->submit(spawner{ pool, total, depth - 1 });
+                pool->submit(spawner{ pool, total, depth - 1 });
+            }
+        }
+    };
+}
+
+void executor_tests() {
+
+#ifdef CLBL_EXECUTOR_TESTS
+    std::cout << "running CLBL_EXECUTOR_TESTS" << std::endl;
+
+    using namespace executor_tests_detail;
+
+    {
+        //tasks are stored in their slots, and only oversized ones go elsewhere
+        STATIC_TEST(sizeof(detail::task) == CLBL_TASK_SLOT_BYTES);
+        STATIC_TEST((executor::fits_task_slot<decltype(fwrap(&add_to)), std::atomic<long>*, long>));
+        STATIC_TEST((executor::fits_task_slot<decltype(fwrap(std::declval<accumulator*>(), &accumulator::add)), long>));
+        STATIC_TEST(!(executor::fits_task_slot<big_task>));
+    }
+    {
+        //wrappers, plain callables and arguments
+        std::atomic<long> total{ 0 };
+        accumulator a{};
+        {
+            executor pool{ 3 };
+            TEST(pool.thread_count() == 3);
+
+            for (long i = 1; i <= 100; ++i) {
+                pool.submit(fwrap(&add_to), &total, i);
+                pool.submit(fwrap(&a, &accumulator::add), i);
+                pool.submit(&add_to, &total, 1L);
+            }
+            pool.submit(bind_front(fwrap(&add_to), &total, 1000L));
+
+            pool.wait_idle();
+            TEST(total == 5050 + 100 + 1000);
+            TEST(a.total == 5050);
+
+            pool.submit(big_task{ &total, {} });
+        }
+        //the destructor runs the remaining tasks
+        TEST(total == 6151);
+    }
+    {
+        //tasks submitted by workers, with more tasks than fit a deque before it grows
+        std::atomic<long> total{ 0 };
+        executor pool{ 2 };
+        pool.submit(spawner{ &pool, &total, 10 });
+        pool.wait_idle();
+        TEST(total == 2047);
+    }
+    {
+        //move-only tasks
+        std::atomic<long> total{ 0 };
+        auto owned = std::unique_ptr<long>(new long(42));
+        executor pool{ 1 };
+        pool.submit([&total](const std::unique_ptr<long>& p) { total += *p; }, std::move(owned));
+        pool.wait_idle();
+        TEST(total == 42);
+    }
+
+#endif
+}
\ No newline at end of file
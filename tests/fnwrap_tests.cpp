@@ -0,0 +1,87 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "void_definitions.h"
+#include "int_char_definitions.h"
+
+#include <iostream>
+#include <type_traits>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace fnwrap_tests_detail {
+
+    template<typename Callback>
+    struct holder : Callback {
+        int value;
+    };
+}
+
+void fnwrap_tests() {
+
+#ifdef CLBL_FNWRAP_TESTS
+    std::cout << "running CLBL_FNWRAP_TESTS" << std::endl;
+
+    {
+        auto f = CLBL_FNWRAP(&int_char_func);
+        auto g = CLBL_FNWRAP(int_char_func);
+        auto h = fn<decltype(&int_char_func), &int_char_func>::fwrap();
+
+        STATIC_TEST((std::is_same<decltype(f), decltype(g)>::value));
+        STATIC_TEST((std::is_same<decltype(f), decltype(h)>::value));
+        STATIC_TEST((std::is_same<decltype(f)::type, const char*(int, char)>::value));
+        STATIC_TEST((std::is_same<decltype(f)::clbl_tag, free_fn_tag>::value));
+
+        //no storage
+        STATIC_TEST(std::is_empty<decltype(f)>::value);
+        STATIC_TEST(sizeof(fnwrap_tests_detail::holder<decltype(f)>) == sizeof(int));
+        STATIC_TEST(is_trivially_relocatable<decltype(f)>);
+
+        TEST(f(1, 'c') == test_id::int_char_func);
+
+        const auto c = f;
+        volatile auto v = f;
+        const volatile auto cv = f;
+
+        TEST(c(1, 'c') == test_id::int_char_func);
+        TEST(v(1, 'c') == test_id::int_char_func);
+        TEST(cv(1, 'c') == test_id::int_char_func);
+    }
+    {
+        auto f = CLBL_FNWRAP(&void_func);
+        TEST(f() == test_id::void_func);
+        TEST(convert_to<std::function>(f)() == test_id::void_func);
+    }
+    {
+        auto f = CLBL_FNWRAP(&int_char_func);
+
+        auto std_func = convert_to<std::function>(f);
+        auto inline_func = convert_to<inline_capacity<1>::function>(f);
+        auto ref = make_function_ref(f);
+
+        STATIC_TEST(std::is_empty<decltype(decltype(f)::copy_invocation(f))>::value);
+        STATIC_TEST((fits_small_buffer<inline_capacity<1>::function, decltype(f)&>));
+
+        TEST(std_func(1, 'c') == test_id::int_char_func);
+        TEST(inline_func(1, 'c') == test_id::int_char_func);
+        TEST(ref(1, 'c') == test_id::int_char_func);
+    }
+    {
+        //rewrapping and hardening keep the slim wrapper
+        auto f = CLBL_FNWRAP(&int_char_func);
+
+        auto rewrapped = fwrap(f);
+        auto rewrapped_ptr = fwrap(&f);
+        auto hardened = harden<const char*(int, char)>(f);
+
+        STATIC_TEST((std::is_same<decltype(rewrapped), decltype(f)>::value));
+        STATIC_TEST((std::is_same<decltype(rewrapped_ptr), decltype(f)>::value));
+        STATIC_TEST((std::is_same<decltype(hardened), decltype(f)>::value));
+
+        TEST(rewrapped(1, 'c') == test_id::int_char_func);
+        TEST(rewrapped_ptr(1, 'c') == test_id::int_char_func);
+        TEST(hardened(1, 'c') == test_id::int_char_func);
+    }
+
+#endif
+}
\ No newline at end of file
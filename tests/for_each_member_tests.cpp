@@ -0,0 +1,127 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace for_each_member_tests_detail {
+
+    struct entity {
+        long position = 0;
+        virtual ~entity() {}
+
+        void update(long dt) { position += dt; }
+        virtual void advance(long dt) { position += dt; }
+        long read() const { return position; }
+        void ref_qualified(long dt) & { position += dt; }
+    };
+
+    struct fast_entity : entity {
+        void advance(long dt) override { position += 2 * dt; }
+    };
+
+    struct checked {
+        int id = 0;
+        void fail_on(int bad) { if (id == bad) throw std::runtime_error("bad id"); }
+    };
+}
+
+void for_each_member_tests() {
+
+#ifdef CLBL_FOR_EACH_MEMBER_TESTS
+    std::cout << "running CLBL_FOR_EACH_MEMBER_TESTS" << std::endl;
+
+    using namespace for_each_member_tests_detail;
+
+    {
+        //contiguous objects
+        std::vector<entity> entities(5);
+        for_each_member(&entity::update, entities, 3L);
+        for_each_member(&entity::ref_qualified, entities, 1L);
+
+        bool all = true;
+        for (auto& e : entities)
+            all = all && e.position == 4;
+        TEST(all);
+
+        //const member functions on const objects
+        const std::array<entity, 2> constant{};
+        for_each_member(&entity::read, constant);
+    }
+    {
+        //pointer ranges, with virtual dispatch per object
+        std::vector<std::unique_ptr<entity> > owned;
+        for (int i = 0; i != 40; ++i)
+            owned.emplace_back(i % 2 ? new fast_entity{} : new entity{});
+
+        std::vector<entity*> raw;
+        for (auto& p : owned)
+            raw.push_back(p.get());
+
+        std::vector<std::shared_ptr<entity> > shared{ std::make_shared<fast_entity>(), std::make_shared<entity>() };
+
+        for_each_member(&entity::advance, owned, 1L);
+        for_each_member(&entity::advance, raw, 1L);
+        for_each_member(&entity::advance, shared, 5L);
+
+        TEST(owned[0]->position == 2);
+        TEST(owned[39]->position == 4);
+        TEST(shared[0]->position == 10);
+        TEST(shared[1]->position == 5);
+    }
+    {
+        //the PMF as a template argument
+        entity objects[3];
+        CLBL_FOR_EACH_MEMBER(&entity::update, objects, 7L);
+        TEST(objects[0].position == 7 && objects[2].position == 7);
+
+        std::vector<entity*> pointers{ &objects[0], &objects[1] };
+        CLBL_FOR_EACH_MEMBER(&entity::advance, pointers, 1L);
+        TEST(objects[1].position == 8 && objects[2].position == 7);
+    }
+    {
+        //parallel mode covers every object exactly once
+        std::vector<entity> entities(3 * CLBL_PARALLEL_GRAIN + 5);
+        for_each_member(parallel, &entity::update, entities, 2L);
+        CLBL_FOR_EACH_MEMBER(&entity::update, parallel, entities, 1L);
+
+        bool all = true;
+        for (auto& e : entities)
+            all = all && e.position == 3;
+        TEST(all);
+
+        //chunks never start past the end, whatever the grain
+        auto small = detail::chunk_range(5, 4, 1);
+        TEST(small.size == 2 && small.count == 3);
+        TEST(detail::chunk_range(0, 4, 1).count == 0);
+        TEST(detail::chunk_range(3, 8, 4096).count == 1);
+
+        auto even = detail::chunk_range(4 * 4096, 4, 4096);
+        TEST(even.size == 4096 && even.count == 4);
+
+        std::vector<entity> empty;
+        for_each_member(parallel, &entity::update, empty, 1L);
+    }
+    {
+        //exceptions from any chunk reach the caller
+        std::vector<checked> objects(2 * CLBL_PARALLEL_GRAIN);
+        objects.back().id = 1;
+
+        bool thrown = false;
+        try {
+            for_each_member(parallel, &checked::fail_on, objects, 1);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        TEST(thrown);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include <iostream>
 #include <functional>
+#include <memory>
+#include <string>
 
 using namespace clbl::tests;
 using namespace clbl;
@@ -46,6 +48,54 @@ namespace fwd_tests {
             return c;
         }
     };
+
+    //function objects that count copies of themselves
+    struct counted_callable {
+        copy_counter counter;
+        void operator()(int) const {}
+    };
+
+    struct counted_overloads {
+        copy_counter counter;
+        void operator()(int) const {}
+        void operator()(const char*) const {}
+    };
+
+    struct counted_member {
+        copy_counter counter;
+        void func(int) const {}
+    };
+
+    //a multi-kilobyte payload that counts its copies
+    struct large_payload {
+        copy_counter counter;
+        char bytes[4096];
+    };
+
+    //returns references to a payload it owns, and payloads by value
+    struct payload_holder {
+        large_payload payload;
+
+        large_payload& get() { return payload; }
+        const large_payload& get_const() const { return payload; }
+        large_payload&& release() { return std::move(payload); }
+        large_payload make() const { return large_payload{ {}, { 'm' } }; }
+    };
+
+    //trivially copyable, but can only be moved
+    struct small_move_only {
+        int value;
+        small_move_only(int v) : value(v) {}
+        small_move_only(small_move_only&&) = default;
+        small_move_only(const small_move_only&) = delete;
+    };
+
+    int take_move_only(std::unique_ptr<int> p) { return *p; }
+    int take_small_move_only(small_move_only m) { return m.value; }
+    int take_move_only_rvalue(std::unique_ptr<int>&& p) { return *p; }
+    void take_payload(large_payload) {}
+    void take_payload_rvalue(large_payload&&) {}
+    void take_payload_ref(const large_payload&) {}
 }
 
 int fwd_tests::copy_counter::value = 0;
@@ -197,6 +247,170 @@ void forwarding_tests() {
         std_func2();
         TEST(copy_counter::value == 0);
     }
+    {
+        //converting an lvalue wrapper copies the object once
+        copy_counter::reset();
+
+        auto f = fwrap(fwd_tests::counted_callable{});
+        auto std_func = convert_to<std::function>(f);
+
+        std_func(1);
+        TEST(copy_counter::value == 1);
+    }
+    {
+        //rvalue pipelines move the object all the way into the std::function
+        copy_counter::reset();
+
+        fwd_tests::counted_callable obj{};
+        auto std_func = convert_to<std::function>(fwrap(std::move(obj)));
+
+        std_func(1);
+        TEST(copy_counter::value == 0);
+    }
+    {
+        copy_counter::reset();
+
+        fwd_tests::counted_member obj{};
+        auto std_func = convert_to<std::function>(fwrap(std::move(obj), &fwd_tests::counted_member::func));
+
+        std_func(1);
+        TEST(copy_counter::value == 0);
+    }
+    {
+        copy_counter::reset();
+
+        fwd_tests::counted_overloads obj{};
+        auto std_func = convert_to<std::function>(
+            harden<void(int) const>(fwrap(std::move(obj))));
+
+        std_func(1);
+        TEST(copy_counter::value == 0);
+    }
+    {
+        //rewrapping and hardening an rvalue wrapper moves its data
+        copy_counter::reset();
+
+        auto f = fwrap(fwd_tests::counted_callable{});
+        auto rewrapped = fwrap(std::move(f));
+        auto hardened = harden<void(int) const>(std::move(rewrapped));
+        auto std_func = convert_to<std::function>(std::move(hardened));
+
+        std_func(1);
+        TEST(copy_counter::value == 0);
+    }
+    {
+        //small trivially copyable arguments are passed by value, everything else through clbl::forward
+        auto f = fwrap(&int_char_func);
+        auto g = fwrap(&fwd_tests::take_payload_ref);
+        auto h = fwrap(&fwd_tests::take_move_only);
+        auto i = fwrap([](double, void*, int&, std::string) {});
+
+        STATIC_TEST((std::is_same<forwarding_glue<decltype(f)>, const char*(int, char)>::value));
+        STATIC_TEST((std::is_same<forwarding_glue<decltype(g)>, void(forward<const fwd_tests::large_payload&>)>::value));
+        STATIC_TEST((std::is_same<forwarding_glue<decltype(h)>, int(forward<std::unique_ptr<int> >)>::value));
+        STATIC_TEST((std::is_same<forwarding_glue<decltype(i)>, void(double, void*, forward<int&>, forward<std::string>)>::value));
+        STATIC_TEST(!passes_by_value<fwd_tests::large_payload>);
+
+        //a glue parameter is copied from the caller's argument, so move-only types take a vessel
+        STATIC_TEST(std::is_trivially_copyable<fwd_tests::small_move_only>::value);
+        STATIC_TEST(!passes_by_value<fwd_tests::small_move_only>);
+        TEST(convert_to<std::function>(fwrap(&fwd_tests::take_small_move_only))(fwd_tests::small_move_only{ 4 }) == 4);
+
+        TEST(convert_to<std::function>(f)(1, 'c') == test_id::int_char_func);
+    }
+    {
+        //move-only arguments are moved from the caller to the original callable
+        auto by_value = convert_to<std::function>(fwrap(&fwd_tests::take_move_only));
+        auto by_rvalue_ref = convert_to<std::function>(fwrap(&fwd_tests::take_move_only_rvalue));
+
+        TEST(by_value(std::make_unique<int>(1)) == 1);
+        TEST(by_rvalue_ref(std::make_unique<int>(2)) == 2);
+
+        auto p = std::make_unique<int>(3);
+        TEST(by_value(std::move(p)) == 3);
+        TEST(!p);
+
+        //lvalues can't be passed to rvalue reference parameters, or copied into by-value ones
+        STATIC_TEST(!(std::is_convertible<std::unique_ptr<int>&, forward<std::unique_ptr<int> > >::value));
+        STATIC_TEST(!(std::is_convertible<std::unique_ptr<int>&, forward<std::unique_ptr<int>&&> >::value));
+
+        //no vessel can be created without an argument to refer to
+        STATIC_TEST(!std::is_default_constructible<forward<std::unique_ptr<int> > >::value);
+        STATIC_TEST(!std::is_default_constructible<forward<std::unique_ptr<int>&> >::value);
+        STATIC_TEST(!std::is_default_constructible<forward<std::unique_ptr<int>&&> >::value);
+    }
+    {
+        //large payloads are copied only when the caller passes an lvalue to a by-value parameter
+        copy_counter::reset();
+        fwd_tests::large_payload payload{};
+
+        auto by_value = convert_to<std::function>(fwrap(&fwd_tests::take_payload));
+        auto by_rvalue_ref = convert_to<std::function>(fwrap(&fwd_tests::take_payload_rvalue));
+        auto by_ref = convert_to<std::function>(fwrap(&fwd_tests::take_payload_ref));
+
+        by_value(std::move(payload));
+        by_value(fwd_tests::large_payload{});
+        by_rvalue_ref(std::move(payload));
+        by_ref(payload);
+        TEST(copy_counter::value == 0);
+
+        by_value(payload);
+        TEST(copy_counter::value == 1);
+    }
+    {
+        //returned references keep their value category through every conversion
+        copy_counter::reset();
+        fwd_tests::payload_holder holder{};
+        auto* expected = &holder.payload;
+
+        auto get = fwrap(&holder, &fwd_tests::payload_holder::get);
+        auto get_const = fwrap(&holder, &fwd_tests::payload_holder::get_const);
+        auto release = fwrap(&holder, &fwd_tests::payload_holder::release);
+        auto generic = fwrap([&holder](auto) -> fwd_tests::large_payload& { return holder.payload; });
+
+        STATIC_TEST((std::is_same<decltype(get()), fwd_tests::large_payload&>::value));
+        STATIC_TEST((std::is_same<decltype(generic(0)), fwd_tests::large_payload&>::value));
+
+        auto std_func = convert_to<std::function>(get);
+        auto const_std_func = convert_to<std::function>(get_const);
+        auto release_std_func = convert_to<std::function>(release);
+        auto unique_func = convert_to<unique_function>(get);
+        auto ref = make_function_ref(get);
+        auto hardened = harden<fwd_tests::large_payload&()>(get);
+        auto generic_std_func = convert_to<std::function>(harden<fwd_tests::large_payload&(int) const>(generic));
+
+        TEST(&std_func() == expected);
+        TEST(&const_std_func() == expected);
+        TEST(&unique_func() == expected);
+        TEST(&ref() == expected);
+        TEST(&hardened() == expected);
+        TEST(&generic(0) == expected);
+        TEST(&generic_std_func(0) == expected);
+
+        fwd_tests::large_payload&& released = release_std_func();
+        TEST(&released == expected);
+        TEST(copy_counter::value == 0);
+    }
+    {
+        //large objects returned by value are constructed in place
+        copy_counter::reset();
+        fwd_tests::payload_holder holder{};
+
+        auto make = fwrap(&holder, &fwd_tests::payload_holder::make);
+        auto std_func = convert_to<std::function>(make);
+        auto unique_func = convert_to<unique_function>(make);
+        auto ref = make_function_ref(make);
+
+        auto a = std_func();
+        auto b = unique_func();
+        auto c = ref();
+        auto d = make();
+        TEST(copy_counter::value == 0);
+        TEST(a.bytes[0] == 'm');
+        TEST(b.bytes[0] == 'm');
+        TEST(c.bytes[0] == 'm');
+        TEST(d.bytes[0] == 'm');
+    }
 
 #endif
 }
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "int_char_definitions.h"
+
+#include <iostream>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace fn_ref_tests {
+
+    struct accumulator {
+        int total = 0;
+        int operator()(int i) { return total += i; }
+    };
+
+    auto call_with_int_char(function_ref<const char*(int, char)> f) {
+        return f(1, 'c');
+    }
+}
+
+void function_ref_tests() {
+
+#ifdef CLBL_FUNCTION_REF_TESTS
+    std::cout << "running CLBL_FUNCTION_REF_TESTS" << std::endl;
+
+    {
+        //function_ref deduces the same signature as clbl::convert_to
+        int_char_struct int_char_object{};
+
+        auto f = fwrap(&int_char_object);
+        auto g = fwrap(&int_char_func);
+        auto h = fwrap(&int_char_object, &int_char_struct::func);
+
+        auto fref = make_function_ref(f);
+        auto gref = make_function_ref(g);
+        auto href = make_function_ref(h);
+
+        using glue = forwarding_glue<decltype(f)>;
+        static_assert(std::is_same<decltype(fref), function_ref<glue> >::value, "");
+        static_assert(std::is_same<decltype(gref), function_ref<glue> >::value, "");
+        static_assert(std::is_same<decltype(href), function_ref<glue> >::value, "");
+        static_assert(sizeof(fref) == 2 * sizeof(void*), "");
+
+        TEST(fref(1, 'c') == test_id::int_char_struct_op);
+        TEST(gref(1, 'c') == test_id::int_char_func);
+        TEST(href(1, 'c') == test_id::int_char_struct_func);
+
+        TEST(fn_ref_tests::call_with_int_char(fref) == test_id::int_char_struct_op);
+        TEST(fn_ref_tests::call_with_int_char(gref) == test_id::int_char_func);
+        TEST(fn_ref_tests::call_with_int_char(href) == test_id::int_char_struct_func);
+    }
+    {
+        //function_ref refers to the wrapper instead of copying it
+        auto f = fwrap(fn_ref_tests::accumulator{});
+        auto fref = make_function_ref(f);
+
+        fref(2);
+        fref(3);
+
+        TEST(f(0) == 5);
+    }
+    {
+        //testing cv-correctness of clbl callables viewed through function_ref
+        auto overloaded_object = overloaded_int_char_struct{};
+
+        auto hnormal = harden<const char*(int, char)>(fwrap(&overloaded_object));
+        auto hc = harden<const char*(int, char) const>(fwrap(&overloaded_object));
+        auto hv = harden<const char*(int, char) volatile>(fwrap(&overloaded_object));
+        auto hcv = harden<const char*(int, char) const volatile>(fwrap(&overloaded_object));
+
+        auto refn = make_function_ref(hnormal);
+        auto refc = make_function_ref(hc);
+        auto refv = make_function_ref(hv);
+        auto refcv = make_function_ref(hcv);
+
+        TEST(refn(1, 'c') == test_id::overloaded_int_char_struct_op);
+        TEST(refc(1, 'c') == test_id::overloaded_int_char_struct_op_c);
+        TEST(refv(1, 'c') == test_id::overloaded_int_char_struct_op_v);
+        TEST(refcv(1, 'c') == test_id::overloaded_int_char_struct_op_cv);
+
+        //the CV of the viewed wrapper is preserved
+        auto ambiguous = fwrap(&overloaded_object);
+        const auto& const_ambiguous = ambiguous;
+
+        using glue = forwarding_glue<decltype(hnormal)>;
+        auto ref_ambiguous = function_ref<glue>{ ambiguous };
+        auto const_ref_ambiguous = function_ref<glue>{ const_ambiguous };
+
+        TEST(ref_ambiguous(1, 'c') == test_id::overloaded_int_char_struct_op);
+        TEST(const_ref_ambiguous(1, 'c') == test_id::overloaded_int_char_struct_op_c);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef INHERITANCE_DEFINITIONS_H
+#define INHERITANCE_DEFINITIONS_H
+
+#include <string>
+
+namespace clbl { namespace tests {
+
+    /*
+    first_base comes first in the layout of derived, so calling a member
+    function of second_base on a derived needs a "this" adjustment
+    */
+
+    struct first_base {
+        long first = 1;
+        virtual ~first_base() {}
+    };
+
+    struct second_base {
+        long second = 2;
+        virtual ~second_base() {}
+
+        long add(long i) const { return i + second; }
+        virtual long scaled(long i) { return i * second; }
+        virtual std::string name(int i) const { return "second_base " + std::to_string(i + second); }
+    };
+
+    struct derived : first_base, second_base {
+        long third = 3;
+        long scaled(long i) override { return i * third; }
+        std::string name(int i) const override { return "derived " + std::to_string(i + third); }
+    };
+
+    //the same layout without virtual functions
+    struct plain_first_base {
+        long first = 1;
+    };
+
+    struct plain_second_base {
+        long second = 2;
+        long add(long i) const { return i + second; }
+    };
+
+    struct plain_derived : plain_first_base, plain_second_base {
+        long third = 3;
+    };
+}}
+
+#endif
\ No newline at end of file
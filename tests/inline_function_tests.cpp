@@ -0,0 +1,151 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "int_char_definitions.h"
+
+#include <iostream>
+#include <string>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace inline_fn_tests {
+
+    struct instance_counter {
+        static int instances;
+        instance_counter() { ++instances; }
+        instance_counter(const instance_counter&) noexcept { ++instances; }
+        ~instance_counter() { --instances; }
+
+        int operator()(int i) const { return i + 1; }
+    };
+
+    int instance_counter::instances = 0;
+
+    //moves never throw, but copies throw once armed
+    struct throwing_copy {
+        static bool armed;
+        static int instances;
+        throwing_copy() { ++instances; }
+        throwing_copy(const throwing_copy&) { if (armed) throw 1; ++instances; }
+        throwing_copy(throwing_copy&&) noexcept { ++instances; }
+        ~throwing_copy() { --instances; }
+
+        int operator()(int i) const { return i * 2; }
+    };
+
+    bool throwing_copy::armed = false;
+    int throwing_copy::instances = 0;
+}
+
+void inline_function_tests() {
+
+#ifdef CLBL_INLINE_FUNCTION_TESTS
+    std::cout << "running CLBL_INLINE_FUNCTION_TESTS" << std::endl;
+
+    {
+        int_char_struct int_char_object{};
+
+        auto f = fwrap(&int_char_object);
+        auto g = fwrap(&int_char_func);
+        auto h = fwrap(&int_char_object, &int_char_struct::func);
+
+        auto f_inline = convert_to<inline_capacity<32>::function>(f);
+        auto g_inline = convert_to<inline_capacity<32>::function>(g);
+        auto h_inline = convert_to<inline_capacity<32>::function>(h);
+
+        using expected_type = inline_function<forwarding_glue<decltype(f)>, 32>;
+        static_assert(std::is_same<decltype(f_inline), expected_type>::value, "");
+        static_assert(std::is_same<decltype(g_inline), expected_type>::value, "");
+        static_assert(std::is_same<decltype(h_inline), expected_type>::value, "");
+
+        TEST(f_inline(1, 'c') == test_id::int_char_struct_op);
+        TEST(g_inline(1, 'c') == test_id::int_char_func);
+        TEST(h_inline(1, 'c') == test_id::int_char_struct_func);
+
+        auto copied = h_inline;
+        TEST(copied(1, 'c') == test_id::int_char_struct_func);
+
+        copied = g_inline;
+        TEST(copied(1, 'c') == test_id::int_char_func);
+
+        auto moved = std::move(copied);
+        TEST(moved(1, 'c') == test_id::int_char_func);
+    }
+    {
+        //testing cv-correctness of clbl callables converted to inline_function
+        auto overloaded_object = overloaded_int_char_struct{};
+
+        auto hnormal = harden<const char*(int, char)>(fwrap(&overloaded_object));
+        auto hc = harden<const char*(int, char) const>(fwrap(&overloaded_object));
+        auto hv = harden<const char*(int, char) volatile>(fwrap(&overloaded_object));
+        auto hcv = harden<const char*(int, char) const volatile>(fwrap(&overloaded_object));
+
+        auto n = convert_to<inline_capacity<16>::function>(hnormal);
+        auto c = convert_to<inline_capacity<16>::function>(hc);
+        auto v = convert_to<inline_capacity<16>::function>(hv);
+        auto cv = convert_to<inline_capacity<16>::function>(hcv);
+
+        TEST(n(1, 'c') == test_id::overloaded_int_char_struct_op);
+        TEST(c(1, 'c') == test_id::overloaded_int_char_struct_op_c);
+        TEST(v(1, 'c') == test_id::overloaded_int_char_struct_op_v);
+        TEST(cv(1, 'c') == test_id::overloaded_int_char_struct_op_cv);
+    }
+    {
+        //non-trivial targets are copied and destroyed through the stored operations
+        using instance_counter = inline_fn_tests::instance_counter;
+        {
+            auto f = convert_to<inline_capacity<16>::function>(fwrap(instance_counter{}));
+            auto g = f;
+            TEST(f(1) == 2);
+            TEST(g(2) == 3);
+
+            inline_capacity<16>::function<forwarding_glue<decltype(fwrap(instance_counter{}))> > h{};
+            TEST(!h);
+            h = std::move(g);
+            TEST(h(3) == 4);
+        }
+
+        TEST(instance_counter::instances == 0);
+    }
+    {
+        //moving never throws, so containers of inline_function move on reallocation
+        using throwing_copy = inline_fn_tests::throwing_copy;
+        using function_type = inline_capacity<16>::function<forwarding_glue<decltype(fwrap(throwing_copy{}))> >;
+
+        STATIC_TEST(std::is_nothrow_move_constructible<function_type>::value);
+        STATIC_TEST(std::is_nothrow_move_assignable<function_type>::value);
+
+        //a failed copy leaves the destination empty, and nothing is destroyed twice
+        {
+            function_type f = convert_to<inline_capacity<16>::function>(fwrap(throwing_copy{}));
+            function_type g = f;
+            TEST(g(2) == 4);
+
+            throwing_copy::armed = true;
+            auto threw = false;
+            try {
+                g = f;
+            }
+            catch (int) {
+                threw = true;
+            }
+            throwing_copy::armed = false;
+
+            TEST(threw);
+            TEST(!g);
+            TEST(f(3) == 6);
+        }
+
+        TEST(throwing_copy::instances == 0);
+    }
+    {
+        //the glue of a capturing lambda lives in the buffer
+        auto message = std::string{ "inline" };
+        auto f = convert_to<inline_capacity<64>::function>(
+            fwrap([message](int i) { return message.size() + i; }));
+
+        TEST(f(1) == 7);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <array>
+#include <iostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace invoke_batch_tests_detail {
+
+    inline float score(float price, float weight) { return price * weight; }
+
+    struct accumulator {
+        long total = 0;
+        long add(long i) { return total += i; }
+    };
+}
+
+void invoke_batch_tests() {
+
+#ifdef CLBL_INVOKE_BATCH_TESTS
+    std::cout << "running CLBL_INVOKE_BATCH_TESTS" << std::endl;
+
+    using namespace invoke_batch_tests_detail;
+
+    {
+        //array-of-structures and structure-of-arrays give the same results
+        std::vector<std::tuple<float, float> > rows{ std::make_tuple(1.f, 2.f), std::make_tuple(3.f, 4.f), std::make_tuple(5.f, 6.f) };
+        std::vector<float> prices{ 1.f, 3.f, 5.f };
+        std::vector<float> weights{ 2.f, 4.f, 6.f };
+        std::vector<float> from_rows(3);
+        std::vector<float> from_columns(3);
+
+        auto f = fwrap(&score);
+
+        TEST(invoke_batch(f, rows, from_rows) == 3);
+        TEST(invoke_batch(f, columns(prices, weights), from_columns) == 3);
+        TEST((from_rows == std::vector<float>{ 2.f, 12.f, 30.f }));
+        TEST(from_rows == from_columns);
+    }
+    {
+        //the batch covers the shortest buffer
+        float prices[] = { 1.f, 2.f, 3.f, 4.f };
+        std::array<float, 3> weights{ { 2.f, 2.f, 2.f } };
+        float out[2] = {};
+        std::pair<float, float> pairs[] = { { 1.f, 1.f }, { 2.f, 2.f }, { 3.f, 3.f } };
+
+        TEST(invoke_batch(CLBL_FNWRAP(&score), columns(prices, weights), out) == 2);
+        TEST(out[0] == 2.f && out[1] == 4.f);
+        TEST(invoke_batch(CLBL_FNWRAP(&score), pairs, out) == 2);
+        TEST(out[0] == 1.f && out[1] == 4.f);
+    }
+    {
+        //state is kept across the batch, and results can be discarded
+        accumulator a{};
+        auto f = fwrap(&a, &accumulator::add);
+        const std::vector<long> values{ 1, 2, 3, 4 };
+        std::vector<long> totals(4);
+
+        TEST(invoke_batch(f, columns(values), totals) == 4);
+        TEST((totals == std::vector<long>{ 1, 3, 6, 10 }));
+
+        std::vector<std::tuple<long> > rows{ std::make_tuple(5L), std::make_tuple(5L) };
+        TEST(invoke_batch(f, rows) == 2);
+        TEST(invoke_batch(f, columns(values)) == 4);
+        TEST(a.total == 30);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -34,6 +34,26 @@ void reference_arg_tests();
 void overload_tests();
 void conversion_tests();
 void forwarding_tests();
+void function_ref_tests();
+void inline_function_tests();
+void trivial_copy_tests();
+void small_buffer_tests();
+void fnwrap_tests();
+void compressed_pmf_tests();
+void devirtualize_tests();
+void ownership_tests();
+void erased_call_tests();
+void noexcept_tests();
+void ref_qualifier_tests();
+void constexpr_tests();
+void bind_front_tests();
+void bind_constant_tests();
+void compose_tests();
+void decorate_tests();
+void invoke_batch_tests();
+void simd_lift_tests();
+void for_each_member_tests();
+void executor_tests();
 void value_tests();
 
 int main() {
@@ -58,6 +78,26 @@ int main() {
     overload_tests();
     conversion_tests();
     forwarding_tests();
+    function_ref_tests();
+    inline_function_tests();
+    trivial_copy_tests();
+    small_buffer_tests();
+    fnwrap_tests();
+    compressed_pmf_tests();
+    devirtualize_tests();
+    ownership_tests();
+    erased_call_tests();
+    noexcept_tests();
+    ref_qualifier_tests();
+    constexpr_tests();
+    bind_front_tests();
+    bind_constant_tests();
+    compose_tests();
+    decorate_tests();
+    invoke_batch_tests();
+    simd_lift_tests();
+    for_each_member_tests();
+    executor_tests();
     value_tests();
     shared_ptr_tests();
     unique_ptr_tests();
@@ -0,0 +1,122 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace noexcept_tests_detail {
+
+    struct nothrow_overloads {
+        int operator()(int i) const noexcept { return i; }
+        int operator()(const char*) const { return 0; }
+    };
+
+    struct throwing_copy {
+        throwing_copy() = default;
+        throwing_copy(const throwing_copy&) {}
+    };
+
+#ifdef __cpp_noexcept_function_type
+    inline int nothrow_func(int i) noexcept { return i; }
+    inline int throwing_func(int i) { return i; }
+
+    struct member_funcs {
+        int nothrow_member(int i) const noexcept { return i; }
+        int throwing_member(int i) const { return i; }
+    };
+#endif
+}
+
+void noexcept_tests() {
+
+#ifdef CLBL_NOEXCEPT_TESTS
+    std::cout << "running CLBL_NOEXCEPT_TESTS" << std::endl;
+
+    using namespace noexcept_tests_detail;
+
+    {
+        //ambiguous wrappers call the object directly, so noexcept is deduced per overload
+        auto f = fwrap(nothrow_overloads{});
+        const auto& c = f;
+        auto invocation = decltype(f)::copy_invocation(f);
+
+        STATIC_TEST(noexcept(f(1)));
+        STATIC_TEST(noexcept(c(1)));
+        STATIC_TEST(!noexcept(f("")));
+        STATIC_TEST(noexcept(invocation(1)));
+        STATIC_TEST(!noexcept(invocation("")));
+
+        TEST(f(1) == 1);
+        TEST(invocation(2) == 2);
+
+        //nothing but the call itself can throw
+        auto p = fwrap(std::make_shared<nothrow_overloads>());
+        STATIC_TEST(noexcept(p(1)));
+        STATIC_TEST(!noexcept(p("")));
+    }
+    {
+        //vessels only throw when the argument they pass by value does
+        STATIC_TEST(noexcept(static_cast<std::string&>(std::declval<forward<std::string&> >())));
+        STATIC_TEST(noexcept(static_cast<std::string&&>(std::declval<forward<std::string&&> >())));
+        STATIC_TEST(noexcept(static_cast<std::unique_ptr<int> >(std::declval<forward<std::unique_ptr<int> > >())));
+        STATIC_TEST(!noexcept(static_cast<std::string>(std::declval<forward<std::string> >())));
+        STATIC_TEST(!noexcept(static_cast<throwing_copy>(std::declval<forward<throwing_copy> >())));
+    }
+    {
+        //wrappers move without throwing, so containers of them move on reallocation
+        auto f = fwrap(std::make_shared<nothrow_overloads>());
+        STATIC_TEST(std::is_nothrow_move_constructible<decltype(f)>::value);
+
+        std::vector<decltype(f)> v{ f };
+        v.reserve(16);
+        TEST(v[0](3) == 3);
+    }
+
+#ifdef __cpp_noexcept_function_type
+    {
+        //since C++17, noexcept is carried from the function type through every layer
+        member_funcs obj{};
+
+        auto nothrow_free = fwrap(&nothrow_func);
+        auto throwing_free = fwrap(&throwing_func);
+        auto nothrow_pmf = fwrap(&obj, &member_funcs::nothrow_member);
+        auto throwing_pmf = fwrap(&obj, &member_funcs::throwing_member);
+        auto nothrow_by_value = fwrap(obj, &member_funcs::nothrow_member);
+
+        STATIC_TEST(member_function_decay_t<decltype(&member_funcs::nothrow_member)>::is_noexcept);
+        STATIC_TEST(!member_function_decay_t<decltype(&member_funcs::throwing_member)>::is_noexcept);
+        STATIC_TEST((std::is_same<member_function_decay<decltype(&member_funcs::nothrow_member)>,
+            int(member_funcs::*)(int)>::value));
+        STATIC_TEST((std::is_same<function_decay<int(int) noexcept>, int(int)>::value));
+
+        STATIC_TEST(is_noexcept<decltype(nothrow_free)>);
+        STATIC_TEST(!is_noexcept<decltype(throwing_free)>);
+        STATIC_TEST(is_noexcept<decltype(nothrow_pmf)>);
+        STATIC_TEST(!is_noexcept<decltype(throwing_pmf)>);
+        STATIC_TEST(is_noexcept<decltype(nothrow_by_value)>);
+        STATIC_TEST(is_noexcept<decltype(fwrap(devirtualize, &obj, &member_funcs::nothrow_member))>);
+        STATIC_TEST(is_noexcept<decltype(CLBL_FNWRAP(&nothrow_func))>);
+        STATIC_TEST(is_noexcept<decltype(CLBL_PMFWRAP(&member_funcs::nothrow_member, &obj))>);
+        STATIC_TEST(is_noexcept<decltype(fwrap(nothrow_pmf))>);
+        STATIC_TEST(is_noexcept<decltype(harden<int(int)>(nothrow_pmf))>);
+
+        //the glue, too
+        auto glue = apply_glue<forwarding_glue<decltype(nothrow_pmf)> >(nothrow_pmf);
+        auto throwing_glue = apply_glue<forwarding_glue<decltype(throwing_pmf)> >(throwing_pmf);
+        STATIC_TEST(noexcept(glue(1)));
+        STATIC_TEST(!noexcept(throwing_glue(1)));
+
+        TEST(nothrow_free(1) == 1);
+        TEST(nothrow_pmf(2) == 2);
+        TEST(glue(3) == 3);
+        TEST(convert_to<std::function>(nothrow_pmf)(4) == 4);
+    }
+#endif
+
+#endif
+}
\ No newline at end of file
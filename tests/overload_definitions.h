@@ -0,0 +1,41 @@
+#ifndef OVERLOAD_DEFINITIONS_H
+#define OVERLOAD_DEFINITIONS_H
+
+#include <string>
+
+namespace clbl { namespace tests {
+
+    /*
+    overloaded and generic callables for the tests of the wrappers that hold
+    another wrapper (clbl::bind_front, clbl::bind_constant, clbl::compose,
+    clbl::decorate)
+    */
+
+    struct int_cv_overloads {
+        std::string operator()(int) { return "non-const"; }
+        std::string operator()(int) const { return "const"; }
+    };
+
+    struct generic_triple {
+        template<typename T>
+        auto operator()(T t) const { return 3 * t; }
+    };
+
+    struct generic_product {
+        template<typename T, typename U>
+        auto operator()(T factor, U value) const { return factor * value; }
+    };
+
+    //called with an int, these pick a different overload than harden<int(long) const>
+    struct int_or_long {
+        int operator()(int) const { return 1; }
+        int operator()(long) const { return 2; }
+    };
+
+    struct int_then_int_or_long {
+        int operator()(int, int) const { return 1; }
+        int operator()(int, long) const { return 2; }
+    };
+}}
+
+#endif
@@ -0,0 +1,167 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "int_char_definitions.h"
+
+#include <iostream>
+#include <memory>
+#include <type_traits>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace ownership_tests_detail {
+
+    struct counted {
+        int refs = 0;
+        int* releases;
+
+        counted(int* r) : releases{ r } {}
+
+        inline const char* func(int, char) { return test_id::int_char_struct_func; }
+    };
+
+    inline void intrusive_ptr_add_ref(counted* p) { ++p->refs; }
+
+    inline void intrusive_ptr_release(counted* p) {
+        ++*p->releases;
+        if (--p->refs == 0) delete p;
+    }
+}
+
+void ownership_tests() {
+
+#ifdef CLBL_OWNERSHIP_TESTS
+    std::cout << "running CLBL_OWNERSHIP_TESTS" << std::endl;
+
+    using ownership_tests_detail::counted;
+
+    {
+        //borrowed wrappers never touch the reference count
+        auto p = std::make_shared<int_char_struct>();
+        auto q = std::make_shared<overloaded_int_char_struct>();
+
+        auto f = fwrap(borrowed, p, &int_char_struct::func);
+        auto g = fwrap(borrowed, p);
+        auto h = fwrap(borrowed, q);
+
+        STATIC_TEST((std::is_same<decltype(f), decltype(fwrap(p.get(), &int_char_struct::func))>::value));
+        STATIC_TEST((std::is_same<decltype(g.data.object_ptr), int_char_struct*>::value));
+
+        auto copy = f;
+        auto std_func = convert_to<std::function>(f);
+        auto hardened = harden<const char*(int, char)>(g);
+
+        TEST(p.use_count() == 1);
+        TEST(q.use_count() == 1);
+        TEST(h(1, 'c') == test_id::overloaded_int_char_struct_op);
+        TEST(copy(1, 'c') == test_id::int_char_struct_func);
+        TEST(std_func(1, 'c') == test_id::int_char_struct_func);
+        TEST(hardened(1, 'c') == test_id::int_char_struct_op);
+
+        /*
+        temporary owning pointers are rejected by a static_assert, e.g.
+        fwrap(borrowed, std::make_unique<int_char_struct>(), &int_char_struct::func)
+        */
+        STATIC_TEST(detail::is_borrowable<std::shared_ptr<int_char_struct>&>);
+        STATIC_TEST(detail::is_borrowable<int_char_struct*>);
+        STATIC_TEST(detail::is_borrowable<int_char_struct* const&>);
+        STATIC_TEST(!detail::is_borrowable<std::shared_ptr<int_char_struct> >);
+        STATIC_TEST(!detail::is_borrowable<std::unique_ptr<int_char_struct> >);
+
+        //empty pointers are borrowed without being dereferenced
+        std::shared_ptr<int_char_struct> empty{};
+        int_char_struct* null = nullptr;
+        TEST(fwrap(borrowed, empty).data.object_ptr == nullptr);
+        TEST(fwrap(borrowed, null).data.object_ptr == nullptr);
+    }
+    {
+        //unique wrappers are move-only, and are moved through rewrapping and conversions
+        auto f = fwrap(unique, std::make_unique<int_char_struct>(), &int_char_struct::func);
+        auto g = fwrap(unique, std::make_unique<int_char_struct>());
+        auto h = fwrap(unique, std::make_unique<overloaded_int_char_struct>());
+
+        STATIC_TEST(!std::is_copy_constructible<decltype(f)>::value);
+        STATIC_TEST(!std::is_copy_constructible<decltype(g)>::value);
+        STATIC_TEST(!std::is_copy_constructible<decltype(h)>::value);
+
+        TEST(f(1, 'c') == test_id::int_char_struct_func);
+        TEST(g(1, 'c') == test_id::int_char_struct_op);
+        TEST(h(1, 'c') == test_id::overloaded_int_char_struct_op);
+
+        auto rewrapped = fwrap(std::move(f));
+        STATIC_TEST((std::is_same<decltype(rewrapped), decltype(f)>::value));
+        TEST(rewrapped(1, 'c') == test_id::int_char_struct_func);
+
+        auto u = convert_to<unique_function>(std::move(rewrapped));
+        TEST(u(1, 'c') == test_id::int_char_struct_func);
+    }
+    {
+        //shared wrappers share ownership with every copy
+        auto p = std::make_shared<int_char_struct>();
+
+        auto f = fwrap(shared, p, &int_char_struct::func);
+        auto g = fwrap(shared, std::make_unique<int_char_struct>(), &int_char_struct::func);
+
+        TEST(p.use_count() == 2);
+        {
+            auto std_func = convert_to<std::function>(f);
+            TEST(p.use_count() == 3);
+            TEST(std_func(1, 'c') == test_id::int_char_struct_func);
+        }
+        TEST(p.use_count() == 2);
+        TEST(g(1, 'c') == test_id::int_char_struct_func);
+    }
+    {
+        //intrusive wrappers use the object's own count, and moves don't touch it
+        int releases = 0;
+        auto p = new counted{ &releases };
+        {
+            auto f = fwrap(intrusive, p, &counted::func);
+            TEST(p->refs == 1);
+
+            auto copy = f;
+            TEST(p->refs == 2);
+
+            auto moved = fwrap(std::move(copy));
+            TEST(p->refs == 2);
+            TEST(moved(1, 'c') == test_id::int_char_struct_func);
+
+            auto std_func = convert_to<std::function>(std::move(moved));
+            TEST(p->refs == 2);
+            TEST(std_func(1, 'c') == test_id::int_char_struct_func);
+        }
+        TEST(releases == 2);
+    }
+    {
+        //CLBL_PMFWRAP takes the same policies, for pmf_ptr_wrapper_slim
+        auto p = std::make_shared<int_char_struct>();
+        int releases = 0;
+        auto q = new counted{ &releases };
+        {
+            auto b = CLBL_PMFWRAP(&int_char_struct::func, borrowed, p);
+            auto u = CLBL_PMFWRAP(&int_char_struct::func, unique, std::make_unique<int_char_struct>());
+            auto s = CLBL_PMFWRAP(&int_char_struct::func, shared, p);
+            auto i = CLBL_PMFWRAP(&counted::func, intrusive, q);
+
+            STATIC_TEST((std::is_same<decltype(b), decltype(CLBL_PMFWRAP(&int_char_struct::func, p.get()))>::value));
+            STATIC_TEST(!std::is_copy_constructible<decltype(u)>::value);
+            TEST(p.use_count() == 2);
+            TEST(q->refs == 1);
+
+            TEST(b(1, 'c') == test_id::int_char_struct_func);
+            TEST(s(1, 'c') == test_id::int_char_struct_func);
+            TEST(i(1, 'c') == test_id::int_char_struct_func);
+
+            auto unique_func = convert_to<unique_function>(std::move(u));
+            TEST(unique_func(1, 'c') == test_id::int_char_struct_func);
+
+            auto std_func = convert_to<std::function>(s);
+            TEST(p.use_count() == 3);
+            TEST(std_func(1, 'c') == test_id::int_char_struct_func);
+        }
+        TEST(p.use_count() == 1);
+        TEST(releases == 1);
+    }
+
+#endif
+}
\ No newline at end of file
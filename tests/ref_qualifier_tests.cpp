@@ -0,0 +1,148 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace ref_qualifier_tests_detail {
+
+    //a builder-style callable, which moves its accumulated state out when it is an rvalue
+    struct builder {
+        std::vector<int> values;
+
+        std::vector<int> operator()() & { return values; }
+        std::vector<int> operator()() && { return std::move(values); }
+    };
+
+    struct which_overload {
+        const char* operator()(int) & { return "&"; }
+        const char* operator()(int) const & { return "const &"; }
+        const char* operator()(int) && { return "&&"; }
+        const char* operator()(int) const && { return "const &&"; }
+    };
+
+    struct rvalue_only {
+        std::string text;
+        std::string operator()() && { return std::move(text); }
+    };
+
+    struct member_builder {
+        std::vector<int> values;
+        std::vector<int> take() && { return std::move(values); }
+        std::vector<int> peek() const & { return values; }
+    };
+
+    template<typename F, typename = void>
+    struct can_call_without_args : std::false_type {};
+
+    template<typename F>
+    struct can_call_without_args<F, decltype(void(std::declval<F>()()))> : std::true_type {};
+
+    template<typename F, typename = void>
+    struct can_call_with_int : std::false_type {};
+
+    template<typename F>
+    struct can_call_with_int<F, decltype(void(std::declval<F>()(1)))> : std::true_type {};
+}
+
+void ref_qualifier_tests() {
+
+#ifdef CLBL_REF_QUALIFIER_TESTS
+    std::cout << "running CLBL_REF_QUALIFIER_TESTS" << std::endl;
+
+    using namespace ref_qualifier_tests_detail;
+
+    {
+        STATIC_TEST(member_function_decay_t<decltype(&member_builder::take)>::ref_flags == qflags::rvalue_reference_);
+        STATIC_TEST(member_function_decay_t<decltype(&member_builder::peek)>::ref_flags == qflags::lvalue_reference_);
+        STATIC_TEST(member_ref_flags<std::vector<int>(member_builder::*)()> == qflags::default_);
+        STATIC_TEST(member_object_flags<decltype(&member_builder::take)> == qflags::default_);
+        STATIC_TEST(member_object_flags<decltype(&member_builder::peek)> == qflags::lvalue_reference_);
+    }
+    {
+        //the value category of a wrapper selects the overload of the object's operator()
+        auto f = fwrap(which_overload{});
+        const auto& c = f;
+
+        TEST(std::string(f(1)) == "&");
+        TEST(std::string(c(1)) == "const &");
+        TEST(std::string(std::move(f)(1)) == "&&");
+        TEST(std::string(std::move(c)(1)) == "const &&");
+        TEST(std::string(fwrap(which_overload{})(1)) == "&&");
+    }
+    {
+        //an rvalue wrapper moves its object's state out, instead of copying it
+        auto b = fwrap(builder{ { 1, 2, 3 } });
+        auto copied = b();
+        TEST(copied.size() == 3);
+        TEST(b.data.object.values.size() == 3);
+
+        auto* buffer = b.data.object.values.data();
+        auto moved = std::move(b)();
+        TEST(moved.data() == buffer);
+        TEST(b.data.object.values.empty());
+    }
+    {
+        //harden selects a ref-qualified overload, which only an rvalue wrapper can call if it is &&-qualified
+        auto make = [] { return fwrap(which_overload{}); };
+
+        auto lvalue = harden<const char*(int) &>(make());
+        auto const_lvalue = harden<const char*(int) const &>(make());
+        auto rvalue = harden<const char*(int) &&>(make());
+        auto const_rvalue = harden<const char*(int) const &&>(make());
+        auto deduced = harden<auto_(int) &&>(make());
+
+        TEST(std::string(lvalue(1)) == "&");
+        TEST(std::string(const_lvalue(1)) == "const &");
+        TEST(std::string(std::move(rvalue)(1)) == "&&");
+        TEST(std::string(std::move(const_rvalue)(1)) == "const &&");
+        TEST(std::string(std::move(deduced)(1)) == "&&");
+
+        STATIC_TEST(!can_call_with_int<decltype(rvalue)&>::value);
+        STATIC_TEST(!can_call_with_int<const decltype(rvalue)&>::value);
+        STATIC_TEST(!can_call_with_int<decltype(const_rvalue)&>::value);
+        STATIC_TEST(!can_call_with_int<decltype(deduced)&>::value);
+        STATIC_TEST(can_call_with_int<decltype(lvalue)&>::value);
+
+        auto b = harden<std::vector<int>() &&>(fwrap(builder{ { 1, 2, 3 } }));
+        STATIC_TEST(!can_call_without_args<decltype(b)&>::value);
+
+        auto* buffer = b.data.object.values.data();
+        TEST(std::move(b)().data() == buffer);
+    }
+    {
+        //a &&-qualified PMF is only called when the wrapper is an rvalue, as with std::invoke
+        auto r = fwrap(rvalue_only{ "a string that doesn't fit the small string buffer" });
+        STATIC_TEST(!can_call_without_args<decltype(r)&>::value);
+        STATIC_TEST(!can_call_without_args<const decltype(r)&&>::value);
+
+        auto* buffer = r.data.object.text.data();
+        auto text = std::move(r)();
+        TEST(text.data() == buffer);
+
+        member_builder obj{ { 1, 2, 3 } };
+        auto peek = fwrap(&obj, &member_builder::peek);
+        auto take = fwrap(&obj, &member_builder::take);
+        auto take_by_value = fwrap(member_builder{ { 4, 5 } }, &member_builder::take);
+
+        TEST(peek().size() == 3);
+        TEST(std::move(peek)().size() == 3);
+
+        //the object behind a pointer is always an lvalue, so it is never moved from
+        STATIC_TEST(!can_call_without_args<decltype(take)&>::value);
+        STATIC_TEST(!can_call_without_args<decltype(take)&&>::value);
+        TEST(obj.values.size() == 3);
+
+        STATIC_TEST(!can_call_without_args<decltype(take_by_value)&>::value);
+        auto* by_value_buffer = take_by_value.data.object.values.data();
+        TEST(std::move(take_by_value)().data() == by_value_buffer);
+    }
+
+#endif
+}
\ No newline at end of file
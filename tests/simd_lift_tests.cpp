@@ -0,0 +1,92 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+
+#include <array>
+#include <iostream>
+#include <vector>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace simd_lift_tests_detail {
+
+    struct affine {
+        template<typename T>
+        T operator()(T x) const { return x * 2.5f + 1.f; }
+    };
+
+    struct multiply_add {
+        template<typename T>
+        T operator()(T a, T b) const { return a * b + a; }
+    };
+
+    struct counting_square {
+        int scalar_calls = 0;
+        int pack_calls = 0;
+
+        int operator()(int x) { ++scalar_calls; return x * x; }
+
+        simd<int> operator()(simd<int> x) { ++pack_calls; return x * x; }
+    };
+
+    inline float scalar_only(float x) { return x + 1.f; }
+}
+
+void simd_lift_tests() {
+
+#ifdef CLBL_SIMD_LIFT_TESTS
+    std::cout << "running CLBL_SIMD_LIFT_TESTS" << std::endl;
+
+    using namespace simd_lift_tests_detail;
+
+    {
+        //packs are the configured width
+        STATIC_TEST(sizeof(simd<float>) == CLBL_SIMD_BYTES);
+        STATIC_TEST(simd_lanes<float> == CLBL_SIMD_BYTES / sizeof(float));
+        STATIC_TEST(simd_lanes<double> == CLBL_SIMD_BYTES / sizeof(double));
+    }
+    {
+        //results match the scalar calls, including the tail
+        std::vector<float> in(2 * simd_lanes<float> + 3);
+        for (std::size_t i = 0; i != in.size(); ++i)
+            in[i] = static_cast<float>(i);
+
+        std::vector<float> out(in.size());
+        auto lifted = simd_lift(fwrap(affine{}));
+
+        TEST(lifted(in, out) == in.size());
+        bool same = true;
+        for (std::size_t i = 0; i != in.size(); ++i)
+            same = same && out[i] == affine{}(in[i]);
+        TEST(same);
+    }
+    {
+        //several columns
+        std::array<double, 7> a{ { 1, 2, 3, 4, 5, 6, 7 } };
+        std::array<double, 7> b{ { 2, 2, 2, 2, 2, 2, 2 } };
+        double out[7] = {};
+
+        TEST(simd_lift(multiply_add{})(columns(a, b), out) == 7);
+        TEST(out[0] == 3 && out[6] == 21);
+    }
+    {
+        //full packs go through the pack overload, the rest through the scalar one
+        std::vector<int> in(simd_lanes<int> * 3 + 1, 3);
+        std::vector<int> out(in.size());
+        auto lifted = simd_lift(counting_square{});
+
+        lifted(in, out);
+        TEST(lifted.callable.data.object.pack_calls == 3);
+        TEST(lifted.callable.data.object.scalar_calls == 1);
+        TEST(out.front() == 9 && out.back() == 9);
+    }
+    {
+        //only callables that accept packs can be lifted
+        STATIC_TEST((is_simd_liftable<decltype(fwrap(affine{})), float>));
+        STATIC_TEST((is_simd_liftable<multiply_add, double, 2>));
+        STATIC_TEST(!(is_simd_liftable<multiply_add, double, 1>));
+        STATIC_TEST(!(is_simd_liftable<decltype(fwrap(&scalar_only)), float>));
+    }
+
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "int_char_definitions.h"
+#include "inheritance_definitions.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+void small_buffer_tests() {
+
+#ifdef CLBL_SMALL_BUFFER_TESTS
+    std::cout << "running CLBL_SMALL_BUFFER_TESTS" << std::endl;
+
+    {
+        int_char_struct int_char_object{};
+
+        auto f = fwrap(&int_char_object, &int_char_struct::func);
+        auto g = CLBL_PMFWRAP(&int_char_struct::func, &int_char_object);
+        auto h = fwrap(&int_char_func);
+        auto i = fwrap(std::make_shared<int_char_struct>(), &int_char_struct::func);
+
+        STATIC_TEST(sizeof(glue_type<decltype(f)&>) == 2 * sizeof(void*) || !CLBL_COMPACT_PMF);
+        STATIC_TEST(sizeof(glue_type<decltype(g)&>) == sizeof(void*));
+
+        STATIC_TEST((fits_small_buffer<inline_capacity<2 * sizeof(void*)>::function, decltype(f)&> || !CLBL_COMPACT_PMF));
+        STATIC_TEST((fits_small_buffer<inline_capacity<sizeof(void*)>::function, decltype(g)&>));
+        STATIC_TEST((!fits_small_buffer<inline_capacity<sizeof(void*)>::function, decltype(i)&>));
+        STATIC_TEST((!fits_small_buffer<unique_function, decltype(f)&>));
+
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(_MSC_VER)
+        STATIC_TEST((fits_small_buffer<std::function, decltype(f)&> || !CLBL_COMPACT_PMF));
+        STATIC_TEST((fits_small_buffer<std::function, decltype(g)&>));
+        STATIC_TEST((fits_small_buffer<std::function, decltype(h)&>));
+#endif
+
+        TEST(convert_to<std::function>(f)(1, 'c') == test_id::int_char_struct_func);
+        TEST(convert_to<std::function>(g)(1, 'c') == test_id::int_char_struct_func);
+        TEST(convert_to<std::function>(h)(1, 'c') == test_id::int_char_func);
+    }
+    {
+        //compact glue applies the "this" adjustment and keeps virtual dispatch
+        derived d{};
+
+        auto adjusted = fwrap(&d, static_cast<long(derived::*)(long) const>(&second_base::add));
+        auto overridden = fwrap(&d, &derived::name);
+        auto through_base = fwrap(static_cast<second_base*>(&d), &second_base::name);
+        const auto const_wrapper = fwrap(&d, &derived::name);
+
+        //a polymorphic class keeps the PMF in the wrapper, but its glue is still compact
+        STATIC_TEST(sizeof(glue_type<decltype(through_base)&>) == 2 * sizeof(void*) || !CLBL_COMPACT_PMF);
+        STATIC_TEST((fits_small_buffer<inline_capacity<2 * sizeof(void*)>::function, decltype(const_wrapper)&> || !CLBL_COMPACT_PMF));
+
+        auto f = convert_to<std::function>(adjusted);
+        auto g = convert_to<std::function>(overridden);
+        auto h = convert_to<std::function>(through_base);
+        auto i = convert_to<std::function>(const_wrapper);
+        auto j = convert_to<inline_capacity<3 * sizeof(void*)>::function>(through_base);
+
+        TEST(f(5) == 7);
+        TEST(g(5) == "derived 8");
+        TEST(h(5) == "derived 8");
+        TEST(i(6) == "derived 9");
+        TEST(j(7) == "derived 10");
+
+        second_base base_object{};
+        auto base_wrapper = fwrap(&base_object, &second_base::name);
+        TEST(convert_to<std::function>(base_wrapper)(5) == "second_base 7");
+    }
+
+#endif
+}
\ No newline at end of file
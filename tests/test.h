@@ -13,7 +13,7 @@
 
 namespace clbl { namespace tests {
         struct some_type {};
-        auto some_callable_object = [](some_type) {};
+        static auto some_callable_object = [](some_type) {};
         extern inline void some_function(some_type) {}
 }}
 
@@ -23,6 +23,26 @@ namespace clbl { namespace tests {
 #define CLBL_REFERENCE_ARG_TESTS
 #define CLBL_VALUE_TESTS
 #define CLBL_FORWARDING_TESTS
+#define CLBL_FUNCTION_REF_TESTS
+#define CLBL_INLINE_FUNCTION_TESTS
+#define CLBL_TRIVIAL_COPY_TESTS
+#define CLBL_SMALL_BUFFER_TESTS
+#define CLBL_FNWRAP_TESTS
+#define CLBL_COMPRESSED_PMF_TESTS
+#define CLBL_DEVIRTUALIZE_TESTS
+#define CLBL_OWNERSHIP_TESTS
+#define CLBL_ERASED_CALL_TESTS
+#define CLBL_NOEXCEPT_TESTS
+#define CLBL_REF_QUALIFIER_TESTS
+#define CLBL_CONSTEXPR_TESTS
+#define CLBL_BIND_FRONT_TESTS
+#define CLBL_BIND_CONSTANT_TESTS
+#define CLBL_COMPOSE_TESTS
+#define CLBL_DECORATE_TESTS
+#define CLBL_INVOKE_BATCH_TESTS
+#define CLBL_SIMD_LIFT_TESTS
+#define CLBL_FOR_EACH_MEMBER_TESTS
+#define CLBL_EXECUTOR_TESTS
 #define CLBL_CV_TESTS
 #define CLBL_SHARED_PTR_TESTS
 #define CLBL_UNIQUE_PTR_TESTS
@@ -71,9 +91,9 @@ void run_tests(
     static_assert(std::is_same<typename G::arg_types, typename H::arg_types>::value, "std::is_same<G::arg_types, H::arg_types>::value");
     static_assert(std::is_same<typename H::arg_types, typename F::arg_types>::value, "std::is_same<H::arg_types, F::arg_types>::value");
 
-    auto f_std_func = convert_to<std::function>(f);
-    auto g_std_func = convert_to<std::function>(g);
-    auto h_std_func = convert_to<std::function>(h);
+    auto f_std_func = clbl::convert_to<std::function>(f);
+    auto g_std_func = clbl::convert_to<std::function>(g);
+    auto h_std_func = clbl::convert_to<std::function>(h);
 
     TEST(f_std_func(args...) == f_result);
     TEST(g_std_func(args...) == g_result);
@@ -98,17 +118,17 @@ void run_tests(
     static_assert(std::is_same<typename G::arg_types, typename H::arg_types>::value, "std::is_same<G::arg_types, H::arg_types>::value");
     static_assert(std::is_same<typename H::arg_types, typename F::arg_types>::value, "std::is_same<H::arg_types, F::arg_types>::value");
 
-    auto f_std_func = convert_to<std::function>(f);
-    auto g_std_func = convert_to<std::function>(g);
-    auto h_std_func = convert_to<std::function>(h);
+    auto f_std_func = clbl::convert_to<std::function>(f);
+    auto g_std_func = clbl::convert_to<std::function>(g);
+    auto h_std_func = clbl::convert_to<std::function>(h);
 
     static_assert(std::is_same<std::function<const char*(void)>, decltype(f_std_func)>::value, "convert_to<std::function>(f)");
     static_assert(std::is_same<std::function<const char*(void)>, decltype(g_std_func)>::value, "convert_to<std::function>(g)");
     static_assert(std::is_same<std::function<const char*(void)>, decltype(h_std_func)>::value, "convert_to<std::function>(h)");
 
-    TEST(f_std_func(args...) == f_result);
-    TEST(g_std_func(args...) == g_result);
-    TEST(h_std_func(args...) == h_result);
+    TEST(f_std_func() == f_result);
+    TEST(g_std_func() == g_result);
+    TEST(h_std_func() == h_result);
 }
 
 #endif
\ No newline at end of file
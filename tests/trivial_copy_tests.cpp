@@ -0,0 +1,115 @@
+#include "test.h"
+#include <CLBL/clbl.h>
+#include "int_char_definitions.h"
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+using namespace clbl::tests;
+using namespace clbl;
+
+namespace trivial_copy_tests_detail {
+
+    template<typename T>
+    constexpr bool is_trivial_payload = std::is_trivially_copyable<T>::value
+        && std::is_trivially_destructible<T>::value
+        && is_trivially_relocatable<T>;
+
+    template<typename Callable>
+    constexpr bool has_trivial_glue = is_trivial_payload<
+        decltype(apply_glue<forwarding_glue<Callable> >(std::declval<Callable&>()))>;
+}
+
+void trivial_copy_tests() {
+
+#ifdef CLBL_TRIVIAL_COPY_TESTS
+    std::cout << "running CLBL_TRIVIAL_COPY_TESTS" << std::endl;
+
+    using trivial_copy_tests_detail::is_trivial_payload;
+    using trivial_copy_tests_detail::has_trivial_glue;
+
+    {
+        //wrappers holding raw pointers, PMFs and trivially copyable objects are trivially copyable
+        int_char_struct int_char_object{};
+
+        auto f = fwrap(&int_char_object);
+        auto g = fwrap(int_char_object);
+        auto h = fwrap(&int_char_func);
+        auto i = fwrap(&int_char_object, &int_char_struct::func);
+        auto j = fwrap(int_char_object, &int_char_struct::func);
+        auto k = CLBL_PMFWRAP(&int_char_struct::func, &int_char_object);
+        auto l = CLBL_PMFWRAP(&int_char_struct::func, int_char_object);
+
+        STATIC_TEST(is_trivial_payload<decltype(f)>);
+        STATIC_TEST(is_trivial_payload<decltype(g)>);
+        STATIC_TEST(is_trivial_payload<decltype(h)>);
+        STATIC_TEST(is_trivial_payload<decltype(i)>);
+        STATIC_TEST(is_trivial_payload<decltype(j)>);
+        STATIC_TEST(is_trivial_payload<decltype(k)>);
+        STATIC_TEST(is_trivial_payload<decltype(l)>);
+
+        STATIC_TEST(has_trivial_glue<decltype(f)>);
+        STATIC_TEST(has_trivial_glue<decltype(g)>);
+        STATIC_TEST(has_trivial_glue<decltype(h)>);
+        STATIC_TEST(has_trivial_glue<decltype(i)>);
+        STATIC_TEST(has_trivial_glue<decltype(j)>);
+        STATIC_TEST(has_trivial_glue<decltype(k)>);
+        STATIC_TEST(has_trivial_glue<decltype(l)>);
+
+        //memcpy relocation into raw storage, from a wrapper bound to a different target
+        int_char_struct other_object{};
+        auto source = fwrap(&other_object, &int_char_struct::operator());
+        STATIC_TEST((std::is_same<decltype(source), decltype(i)>::value));
+
+        alignas(decltype(i)) unsigned char storage[sizeof(i)];
+        std::memcpy(storage, &source, sizeof(source));
+        auto& relocated = *reinterpret_cast<decltype(i)*>(storage);
+        TEST(relocated(1, 'c') == test_id::int_char_struct_op);
+    }
+    {
+        //hardened and nested wrappers stay trivially copyable
+        auto overloaded_object = overloaded_int_char_struct{};
+        auto int_char_object = int_char_struct{};
+
+        auto hc = harden<const char*(int, char) const>(fwrap(&overloaded_object));
+        auto nested = fwrap(fwrap(&int_char_object, &int_char_struct::func));
+
+        STATIC_TEST(is_trivial_payload<decltype(hc)>);
+        STATIC_TEST(is_trivial_payload<decltype(nested)>);
+        STATIC_TEST(has_trivial_glue<decltype(hc)>);
+        STATIC_TEST(has_trivial_glue<decltype(nested)>);
+    }
+    {
+        //wrappers over non-trivial objects are not
+        auto message = std::string{ "not trivial" };
+        auto f = fwrap([message](int i) { return message.size() + i; });
+        auto g = fwrap(std::make_shared<int_char_struct>());
+
+        STATIC_TEST(!is_trivial_payload<decltype(f)>);
+        STATIC_TEST(!is_trivial_payload<decltype(g)>);
+        STATIC_TEST(!has_trivial_glue<decltype(f)>);
+        STATIC_TEST(!has_trivial_glue<decltype(g)>);
+    }
+    {
+        //copying from volatile wrappers still works
+        auto overloaded_object = overloaded_int_char_struct{};
+
+        volatile auto v = fwrap(&overloaded_object);
+        const volatile auto cv = harden<const char*(int, char) const>(fwrap(overloaded_object));
+
+        auto v_copy = v;
+        auto cv_copy = cv;
+
+        STATIC_TEST((std::is_same<decltype(v_copy), std::remove_cv_t<decltype(v)> >::value));
+        STATIC_TEST((std::is_same<decltype(cv_copy), std::remove_cv_t<decltype(cv)> >::value));
+        STATIC_TEST(is_trivial_payload<decltype(v_copy)>);
+
+        TEST(harden<const char*(int, char) volatile>(v_copy)(1, 'c') == test_id::overloaded_int_char_struct_op_v);
+        TEST(cv_copy(1, 'c') == test_id::overloaded_int_char_struct_op_c);
+    }
+
+#endif
+}
\ No newline at end of file
@@ -47,6 +47,43 @@ void unique_ptr_tests() {
         auto expected_result = std::string{ "1" } +std::string{ destroyed_message };
         TEST(ss.str() == expected_result);
     }
+    {
+        //moving a unique_ptr wrapper into a unique_function transfers ownership
+        std::stringstream ss{};
+
+        {
+            auto f = fwrap(std::make_unique<scope_test>(ss), &scope_test::func);
+            auto stdf = convert_to<unique_function>(std::move(f));
+
+            static_assert(std::is_same<decltype(stdf), 
+                unique_function<forwarding_glue<decltype(f)> > >::value, "");
+
+            stdf(1);
+            TEST(ss.str() == "1");
+
+            auto moved = std::move(stdf);
+            TEST(!stdf);
+
+            moved(2);
+            TEST(ss.str() == "12");
+        }
+
+        auto expected_result = std::string{ "12" } +std::string{ destroyed_message };
+        TEST(ss.str() == expected_result);
+    }
+    {
+        //slim wrappers take the same path
+        std::stringstream ss{};
+
+        {
+            auto f = CLBL_PMFWRAP(&scope_test::func, std::make_unique<scope_test>(ss));
+            auto stdf = convert_to<unique_function>(std::move(f));
+            stdf(3);
+        }
+
+        auto expected_result = std::string{ "3" } +std::string{ destroyed_message };
+        TEST(ss.str() == expected_result);
+    }
 
 #endif
 }
\ No newline at end of file